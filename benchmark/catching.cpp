@@ -0,0 +1,144 @@
+/* Benchmark of the cost of catching() versus hand written try and catch
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Build with something like:
+
+g++ -std=c++17 -O3 -DNDEBUG catching.cpp -o catching
+clang++ -std=c++17 -O3 -DNDEBUG catching.cpp -o catching
+
+Prints the average CPU ticks taken to call a function which might throw,
+plainly, via a hand written try and catch returning an outcome, and via
+catching(). catching() ought to cost the same as the hand written try and
+catch, and both the same as the plain call when nothing is thrown.
+*/
+
+#include "timing.h"
+#include <stdio.h>
+
+#include "../include/outcome/catching.hpp"
+
+#include <stdexcept>
+
+#define ITERATIONS 10000000
+#define THROWING_ITERATIONS 100000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+extern volatile int counter;
+volatile int counter, forcereturn;
+
+#ifdef _MSC_VER
+#define NOINLINE __declspec(noinline)
+#else
+#define NOINLINE __attribute__((noinline))
+#endif
+
+// Stands in for a third party function which reports failure by throwing
+extern NOINLINE int third_party(int x)
+{
+  if(x < 0)
+  {
+    throw std::invalid_argument("negative");
+  }
+  return x + counter;
+}
+
+NOINLINE outcome::outcome<int> hand_written(int x) noexcept
+{
+  try
+  {
+    return third_party(x);
+  }
+  catch(...)
+  {
+    auto ec = outcome::error_from_exception(std::current_exception(), {});
+    if(ec)
+    {
+      return ec;
+    }
+    return std::current_exception();
+  }
+}
+
+NOINLINE outcome::outcome<int> with_catching(int x) noexcept
+{
+  return outcome::catching(third_party, x);
+}
+
+NOINLINE int plain(int x)
+{
+  return third_party(x);
+}
+
+template <class F> void benchmark(const char *name, F &&f)
+{
+  int ret = 0;
+  auto start = ticksclock();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    ret += f(n);
+  }
+  auto end = ticksclock();
+  forcereturn = ret;
+  double ticks = end - start;
+  ticks /= ITERATIONS;
+  start = ticksclock();
+  for(int n = 0; n < THROWING_ITERATIONS; n++)
+  {
+    ret += f(-1 - n);
+  }
+  end = ticksclock();
+  forcereturn = ret;
+  double throwing_ticks = end - start;
+  throwing_ticks /= THROWING_ITERATIONS;
+  printf("%s: %f (%f when throwing)\n", name, ticks, throwing_ticks);
+}
+
+int main(void)
+{
+  {
+    usCount start = GetUsCount();
+    while(GetUsCount() - start < 1 * 1000000000000LL)
+      ;
+  }
+  benchmark("plain call", [](int x) {
+    try
+    {
+      return plain(x);
+    }
+    catch(...)
+    {
+      return 0;
+    }
+  });
+  benchmark("hand written try and catch", [](int x) {
+    auto r = hand_written(x);
+    return r.has_value() ? r.assume_value() : 0;
+  });
+  benchmark("catching()", [](int x) {
+    auto r = with_catching(x);
+    return r.has_value() ? r.assume_value() : 0;
+  });
+  return 0;
+}
@@ -0,0 +1,221 @@
+#!/usr/bin/python3
+# Benchmark the build time of a project using Outcome via headers, a precompiled header, and C++ modules
+# (C) 2026 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2026
+#
+# Usage: compile-time.py [--compiler g++] [--sources 500] [--jobs N] [--modules] [extra compiler args ...]
+#
+# Generates a synthetic project of --sources translation units, each of which
+# instantiates a few basic_result and basic_outcome types of its own, and
+# builds it two ways, or three with --modules:
+#
+#   headers:  every translation unit includes Outcome
+#   pch:      every translation unit includes a precompiled Outcome
+#   modules:  every translation unit imports the Outcome module
+#
+# The time to precompile the header or module is included in the totals. The
+# Outcome module needs GCC 14 or clang 17 or later, and building it here has
+# not yet been tried with either, so it is opt in. Pass the include path of
+# QuickCppLib and status-code as extra compiler args if they aren't installed.
+
+import sys, os, subprocess, shlex, time, shutil, argparse, multiprocessing
+
+clock = time.perf_counter
+here = os.path.dirname(os.path.abspath(__file__))
+include_dir = os.path.normpath(os.path.join(here, '..', 'include'))
+
+class Library(object):
+    "An Outcome header and its module interface"
+    def __init__(self, name, header, interface, module_name_macro):
+        self.name = name
+        self.header = header
+        self.interface = interface
+        self.module_name_macro = module_name_macro
+
+    def uses(self, idx):
+        "Code which uses the library in translation unit idx"
+        return r'''namespace outcome = OUTCOME_V2_NAMESPACE;
+struct udt%(idx)04d { int a; std::string b; };
+outcome::result<udt%(idx)04d> make%(idx)04d(int x) noexcept
+{
+  if(x < 0)
+    return std::errc::invalid_argument;
+  return udt%(idx)04d{x, std::to_string(x)};
+}
+outcome::outcome<std::string> name%(idx)04d(int x)
+{
+  OUTCOME_TRY(auto &&v, make%(idx)04d(x));
+  return v.b;
+}
+outcome::outcome<void> check%(idx)04d(int x)
+{
+  OUTCOME_TRY(name%(idx)04d(x));
+  return outcome::success();
+}
+''' % {'idx': idx}
+
+class ExperimentalLibrary(Library):
+    def uses(self, idx):
+        return r'''namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+struct udt%(idx)04d { int a; std::string b; };
+outcome_e::status_result<udt%(idx)04d> make%(idx)04d(int x) noexcept
+{
+  if(x < 0)
+  {
+    OUTCOME_TRY(outcome_e::posix::close(-1));
+  }
+  return udt%(idx)04d{x, std::to_string(x)};
+}
+outcome_e::status_result<std::string> name%(idx)04d(int x)
+{
+  OUTCOME_TRY(auto &&v, make%(idx)04d(x));
+  return v.b;
+}
+outcome_e::status_result<void> check%(idx)04d(int x)
+{
+  OUTCOME_TRY(name%(idx)04d(x));
+  return outcome_e::success();
+}
+''' % {'idx': idx}
+
+libraries = [
+    Library('outcome', 'outcome.hpp', 'outcome.ixx', 'OUTCOME_V2_CXX_MODULE_NAME'),
+    ExperimentalLibrary('experimental', 'outcome/experimental/posix.hpp', 'outcome-experimental.ixx', 'OUTCOME_V2_CXX_EXPERIMENTAL_MODULE_NAME'),
+]
+
+def run(args, cwd):
+    "Runs a compiler invocation, returning the CPU seconds it took"
+    begin = os.times()
+    try:
+        subprocess.check_output(args, cwd=cwd, stderr=subprocess.STDOUT)
+    except subprocess.CalledProcessError as e:
+        print(' '.join(args))
+        print(e.output.decode('utf-8'))
+        raise
+    end = os.times()
+    return (end.children_user - begin.children_user) + (end.children_system - begin.children_system)
+
+def run_star(a):
+    return run(*a)
+
+class Build(object):
+    "Base class for a way of building the synthetic project"
+    def __init__(self, compiler, flags, library):
+        self.compiler = compiler
+        self.flags = flags
+        self.library = library
+        self.is_clang = 'clang' in compiler
+
+    def preamble(self):
+        "Preamble written out before each source file"
+        return '#include <string>\n#include <system_error>\n#include "%s"\n' % self.library.header
+
+    def prepare(self, cwd):
+        "Builds whatever is shared by all translation units, returning the CPU seconds taken"
+        return 0.0
+
+    def compile_args(self, source):
+        return [self.compiler] + self.flags + ['-c', source, '-o', source + '.o']
+
+    def generate_sources(self, cwd, no):
+        sources = []
+        for n in range(0, no):
+            source = "source%04d.cpp" % n
+            with open(os.path.join(cwd, source), 'wt') as oh:
+                oh.write(self.preamble())
+                oh.write(self.library.uses(n))
+            sources.append(source)
+        return sources
+
+class HeadersBuild(Build):
+    name = 'headers'
+
+class PrecompiledHeaderBuild(Build):
+    name = 'pch'
+
+    def preamble(self):
+        return '#include "pch.hpp"\n'
+
+    def prepare(self, cwd):
+        with open(os.path.join(cwd, 'pch.hpp'), 'wt') as oh:
+            oh.write(Build.preamble(self))
+        if self.is_clang:
+            return run([self.compiler] + self.flags + ['-x', 'c++-header', 'pch.hpp', '-o', 'pch.hpp.pch'], cwd)
+        return run([self.compiler] + self.flags + ['-x', 'c++-header', 'pch.hpp', '-o', 'pch.hpp.gch'], cwd)
+
+    def compile_args(self, source):
+        if self.is_clang:
+            return [self.compiler] + self.flags + ['-include-pch', 'pch.hpp.pch', '-c', source, '-o', source + '.o']
+        return Build.compile_args(self, source)
+
+class ModulesBuild(Build):
+    name = 'modules'
+
+    def __init__(self, compiler, flags, library):
+        Build.__init__(self, compiler, flags, library)
+        if not self.is_clang:
+            self.flags = self.flags + ['-fmodules-ts']
+
+    def module_name(self, cwd):
+        "Asks the compiler what the module is called, as it varies with Outcome's version"
+        with open(os.path.join(cwd, 'module_name.cpp'), 'wt') as oh:
+            oh.write('#include "outcome/config.hpp"\nmodule_name_is %s\n' % self.library.module_name_macro)
+        out = subprocess.check_output([self.compiler] + self.flags + ['-E', '-P', 'module_name.cpp'], cwd=cwd).decode('utf-8')
+        return [line.split()[1] for line in out.splitlines() if line.startswith('module_name_is')][0]
+
+    def preamble(self):
+        return '#include <string>\n#include <system_error>\n#include "outcome/try.hpp"\nimport %s;\n' % self.name_of_module
+
+    def prepare(self, cwd):
+        self.name_of_module = self.module_name(cwd)
+        interface = os.path.join(include_dir, self.library.interface)
+        if self.is_clang:
+            pcm = self.name_of_module + '.pcm'
+            self.flags = self.flags + ['-fprebuilt-module-path=.']
+            return run([self.compiler] + self.flags + ['--precompile', '-x', 'c++-module', interface, '-o', pcm], cwd) + \
+                   run([self.compiler] + self.flags + ['-c', pcm, '-o', 'module.o'], cwd)
+        # GCC writes the compiled module interface into gcm.cache in its working directory
+        return run([self.compiler] + self.flags + ['-x', 'c++', '-c', interface, '-o', 'module.o'], cwd)
+
+builds = [HeadersBuild, PrecompiledHeaderBuild]
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Benchmark the build time of a project using Outcome.')
+    parser.add_argument('--compiler', default='g++', help='C++ compiler to use')
+    parser.add_argument('--sources', type=int, default=500, help='number of translation units to generate')
+    parser.add_argument('--jobs', type=int, default=multiprocessing.cpu_count(), help='number of translation units to compile concurrently')
+    parser.add_argument('--library', choices=[l.name for l in libraries], action='append', help='which Outcome to benchmark, defaults to all')
+    parser.add_argument('--modules', action='store_true', help='also build via the Outcome modules (experimental)')
+    args, extra = parser.parse_known_args()
+    if args.modules:
+        builds.append(ModulesBuild)
+    flags = ['-std=c++20', '-O2', '-I' + include_dir] + extra
+
+    with open('results-compile-time-' + sys.platform + '.csv', 'wt') as resultsh:
+        resultsh.write('"Library","Build","Sources","Prepare CPU secs","Total CPU secs","Wall secs"\n')
+        for library in libraries:
+            if args.library and library.name not in args.library:
+                continue
+            for build in builds:
+                instance = build(args.compiler, flags, library)
+                cwd = os.path.abspath('compile-time-' + library.name + '-' + instance.name)
+                if os.path.exists(cwd):
+                    shutil.rmtree(cwd)
+                os.makedirs(cwd)
+                try:
+                    print("\nBuilding", args.sources, "sources using", library.name, "via", instance.name, "...")
+                    compile_begin = clock()
+                    prepare = instance.prepare(cwd)
+                    sources = instance.generate_sources(cwd, args.sources)
+                    pool = multiprocessing.Pool(args.jobs)
+                    try:
+                        cpu = prepare + sum(pool.map(run_star, [(instance.compile_args(s), cwd) for s in sources]))
+                    finally:
+                        pool.close()
+                        pool.join()
+                    compile_end = clock()
+                    print("Build took", compile_end - compile_begin, "secs wall,", cpu, "secs CPU of which", prepare, "secs was preparation.")
+                    resultsh.write('"%s","%s",%d,%f,%f,%f\n' % (library.name, instance.name, args.sources, prepare, cpu, compile_end - compile_begin))
+                    resultsh.flush()
+                finally:
+                    shutil.rmtree(cwd)
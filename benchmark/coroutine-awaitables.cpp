@@ -0,0 +1,89 @@
+/* Benchmark of the cost of awaiting Outcome's awaitables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Build with something like:
+
+g++ -std=c++20 -O3 -DNDEBUG -fcoroutines coroutine-awaitables.cpp -o coroutine-awaitables
+
+Prints the average CPU ticks taken to create, await and destroy a coroutine
+which does not cross threads, for each of the non-atomic and atomic awaitables.
+The atomic awaitables ought to cost much the same as the non-atomic ones.
+*/
+
+#include "timing.h"
+#include <stdio.h>
+
+#include "../include/outcome/coroutine_support.hpp"
+
+#define ITERATIONS 1000000
+
+namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+
+extern volatile int counter;
+volatile int counter, forcereturn;
+
+template <template <class, class> class Awaitable> Awaitable<int, void> callee(int x)
+{
+  co_return x + counter;
+}
+
+template <template <class, class> class Awaitable> awaitables::lazy<int> caller()
+{
+  int ret = 0;
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    ret += co_await callee<Awaitable>(n);
+  }
+  co_return ret;
+}
+
+template <template <class, class> class Awaitable> void benchmark(const char *name)
+{
+  auto t = caller<Awaitable>();
+  auto start = ticksclock();
+#if OUTCOME_HAVE_NOOP_COROUTINE
+  t.await_suspend({}).resume();
+#else
+  t.await_suspend({});
+#endif
+  auto end = ticksclock();
+  forcereturn = t.await_resume();
+  double ticks = end - start;
+  ticks /= ITERATIONS;
+  printf("%s: %f\n", name, ticks);
+}
+
+int main(void)
+{
+  {
+    usCount start = GetUsCount();
+    while(GetUsCount() - start < 1 * 1000000000000LL)
+      ;
+  }
+  benchmark<awaitables::eager>("eager<int>");
+  benchmark<awaitables::atomic_eager>("atomic_eager<int>");
+  benchmark<awaitables::lazy>("lazy<int>");
+  benchmark<awaitables::atomic_lazy>("atomic_lazy<int>");
+  return 0;
+}
@@ -0,0 +1,70 @@
+#!/usr/bin/python3
+# Report the preprocessed size and parse time of each Outcome header
+# (C) 2026 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2026
+#
+# Usage: header-cost.py [--compiler g++] [--std c++17] [--repeat 3] [header ...] [-- extra compiler args ...]
+#
+# For each header, which defaults to the entry point headers of include/ and
+# every header in single-header/, a translation unit including only that header
+# is preprocessed to count its lines and tokens, and then parsed with
+# -fsyntax-only to time it. The results are written into
+# results-header-cost-<platform>.csv. Pass the include path of QuickCppLib and
+# status-code as extra compiler args if they aren't installed.
+
+import sys, os, subprocess, re, glob, argparse, tempfile, shutil
+
+here = os.path.dirname(os.path.abspath(__file__))
+root = os.path.normpath(os.path.join(here, '..'))
+include_dir = os.path.join(root, 'include')
+
+default_headers = [os.path.join(include_dir, x) for x in ('outcome.hpp', 'outcome/outcome.hpp', 'outcome/result.hpp', 'outcome/result_fwd.hpp',
+                                                          'outcome/basic_outcome.hpp', 'outcome/experimental/status_result.hpp')] \
+                  + sorted(glob.glob(os.path.join(root, 'single-header', '*.hpp')))
+
+# Identifiers, numbers, string and character literals, and punctuators
+token_re = re.compile(r'''[A-Za-z_]\w*|\.?\d(?:[\w.']|[eEpP][+-])*|"(?:\\.|[^"\\])*"|'(?:\\.|[^'\\])*'|\.\.\.|->\*?|<<=|>>=|##|::|[-+*/%^&|<>=!]=|&&|\|\||\+\+|--|<<|>>|\S''')
+
+def run(args, cwd):
+    "Runs a compiler invocation, returning its output and the CPU seconds it took"
+    begin = os.times()
+    p = subprocess.run(args, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    end = os.times()
+    if p.returncode != 0:
+        print(' '.join(args))
+        print(p.stderr.decode('utf-8', 'replace'))
+        raise RuntimeError('compilation failed')
+    return p.stdout.decode('utf-8', 'replace'), (end.children_user - begin.children_user) + (end.children_system - begin.children_system)
+
+def measure(compiler, flags, header, repeat, cwd):
+    "Returns (lines, tokens, bytes, CPU seconds to parse) of a translation unit including only header"
+    with open(os.path.join(cwd, 'header.cpp'), 'wt') as oh:
+        oh.write('#include "%s"\n' % header)
+    out, _ = run([compiler] + flags + ['-E', '-P', 'header.cpp'], cwd)
+    lines = sum(1 for line in out.splitlines() if line.strip())
+    tokens = len(token_re.findall(out))
+    secs = min(run([compiler] + flags + ['-fsyntax-only', 'header.cpp'], cwd)[1] for n in range(0, repeat))
+    return lines, tokens, len(out), secs
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Report the preprocessed size and parse time of each Outcome header.')
+    parser.add_argument('--compiler', default='g++', help='C++ compiler to use')
+    parser.add_argument('--std', default='c++17', help='C++ standard to compile with')
+    parser.add_argument('--repeat', type=int, default=3, help='number of parses, the quickest of which is reported')
+    parser.add_argument('headers', nargs='*', help='headers to measure, defaults to the entry point and single headers')
+    args, extra = parser.parse_known_args()
+    flags = ['-std=' + args.std, '-I' + include_dir] + extra
+    headers = [os.path.abspath(x) for x in args.headers] or default_headers
+
+    cwd = tempfile.mkdtemp(prefix='header-cost-')
+    try:
+        with open('results-header-cost-' + sys.platform + '.csv', 'wt') as resultsh:
+            resultsh.write('"Header","Lines","Tokens","Bytes","Parse CPU secs"\n')
+            print("%-50s %10s %10s %12s %10s" % ('Header', 'Lines', 'Tokens', 'Bytes', 'Parse secs'))
+            for header in headers:
+                name = os.path.relpath(header, root)
+                lines, tokens, size, secs = measure(args.compiler, flags, header, args.repeat, cwd)
+                print("%-50s %10d %10d %12d %10.3f" % (name, lines, tokens, size, secs))
+                resultsh.write('"%s",%d,%d,%d,%f\n' % (name, lines, tokens, size, secs))
+    finally:
+        shutil.rmtree(cwd)
@@ -0,0 +1,181 @@
+#!/usr/bin/python3
+# Benchmark the compile time cost of instantiating basic_result and basic_outcome
+# (C) 2026 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2026
+#
+# Usage: instantiation-cost.py [--compiler g++] [--std c++17] [--types 200] [--call-sites 1000]
+#                              [--single-header] [--baseline file.json] [--update-baseline]
+#                              [extra compiler args ...]
+#
+# Generates a single translation unit with --types distinct result and outcome
+# types, and --call-sites functions constructing them through each of the
+# constraint checked constructors. It is compiled with -ftime-report (GCC) or
+# -ftime-trace (clang), and a JSON summary of the time spent in each phase of
+# the compiler is written to results-instantiation-cost-<platform>.json.
+#
+# If a baseline from the same compiler is given, the totals are compared and
+# the exit code is non-zero if the build got more than --tolerance slower. Pass
+# the include path of QuickCppLib as an extra compiler arg if it isn't installed.
+
+import sys, os, subprocess, json, re, argparse, tempfile, shutil
+
+here = os.path.dirname(os.path.abspath(__file__))
+include_dir = os.path.normpath(os.path.join(here, '..', 'include'))
+single_header = os.path.normpath(os.path.join(here, '..', 'single-header', 'outcome.hpp'))
+
+def generate_source(types, call_sites, header):
+    "Returns a translation unit with types result and outcome types, and call_sites uses of them"
+    out = ['#include "%s"' % header, '#include <string>', '#include <system_error>',
+           'namespace outcome = OUTCOME_V2_NAMESPACE;']
+    for n in range(0, types):
+        out.append(r'''struct udt%(n)04d
+{
+  int a;
+  explicit udt%(n)04d(int x) : a(x) {}
+};
+outcome::result<udt%(n)04d> make%(n)04d(int x) noexcept
+{
+  if(x < 0)
+  {
+    return std::errc::invalid_argument;
+  }
+  return udt%(n)04d{x};
+}
+outcome::outcome<udt%(n)04d> wrap%(n)04d(int x)
+{
+  OUTCOME_TRY(auto &&v, make%(n)04d(x));
+  return v;
+}''' % {'n': n})
+    # Each call site constructs through a different constructor, so each
+    # constructor's constraints are checked for every type
+    constructions = [
+        'outcome::result<udt%(n)04d> r(outcome::in_place_type<udt%(n)04d>, x)',
+        'outcome::result<udt%(n)04d> r(outcome::success(udt%(n)04d{x}))',
+        'outcome::result<udt%(n)04d> r(outcome::failure(std::errc::invalid_argument))',
+        'outcome::result<udt%(n)04d, std::errc> r(std::errc::invalid_argument)',
+        'outcome::outcome<udt%(n)04d> r(make%(n)04d(x))',
+        'outcome::outcome<udt%(n)04d> r(wrap%(n)04d(x))',
+    ]
+    for m in range(0, call_sites):
+        n = m % types
+        construction = constructions[(m // types) % len(constructions)] % {'n': n}
+        out.append(r'''int call%(m)05d(int x)
+{
+  %(construction)s;
+  return r ? r.value().a : -1;
+}''' % {'m': m, 'construction': construction})
+    return '\n'.join(out) + '\n'
+
+def compiler_id(compiler):
+    "Returns the first line of the compiler's version banner"
+    return subprocess.check_output([compiler, '--version']).decode('utf-8').splitlines()[0].strip()
+
+def parse_gcc_time_report(text):
+    "Parses the -ftime-report table into CPU seconds per phase"
+    phases = {}
+    for line in text.splitlines():
+        # " template instantiation   :   0.35 ( 20%)   0.02 (  9%)   0.38 ( 19%)    41M ( 30%)"
+        m = re.match(r'^\s*(.+?)\s*:\s*([\d.]+)\s*(?:\(\s*\d+%\))?\s*([\d.]+)\s*(?:\(\s*\d+%\))?\s*([\d.]+)', line)
+        if m:
+            secs = float(m.group(2)) + float(m.group(3))
+            if secs > 0:
+                phases[m.group(1)] = round(secs, 3)
+    return phases
+
+def parse_clang_time_trace(path):
+    "Parses the -ftime-trace JSON into seconds for each 'Total' event"
+    phases = {}
+    with open(path, 'rt') as ih:
+        for event in json.load(ih)['traceEvents']:
+            name = event.get('name', '')
+            if name.startswith('Total ') and event.get('dur', 0) > 0:
+                phases[name[6:]] = round(event['dur'] / 1000000.0, 3)
+    return phases
+
+def measure(compiler, flags, cwd):
+    "Compiles the translation unit in cwd, returning (CPU seconds, phases)"
+    is_clang = 'clang' in compiler
+    args = [compiler] + flags + ['-c', 'instantiation.cpp', '-o', 'instantiation.o']
+    args.append('-ftime-trace' if is_clang else '-ftime-report')
+    begin = os.times()
+    p = subprocess.run(args, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    end = os.times()
+    output = p.stdout.decode('utf-8', 'replace')
+    if p.returncode != 0:
+        print(' '.join(args))
+        print(output)
+        raise RuntimeError('compilation failed')
+    if is_clang:
+        phases = parse_clang_time_trace(os.path.join(cwd, 'instantiation.json'))
+    else:
+        phases = parse_gcc_time_report(output)
+    return (end.children_user - begin.children_user) + (end.children_system - begin.children_system), phases
+
+def compare(summary, baseline, tolerance):
+    "Prints the change from the baseline, returning False if the total regressed by more than tolerance"
+    for key in ('compiler', 'flags', 'header', 'types', 'call_sites'):
+        if baseline.get(key) != summary[key]:
+            print("\nBaseline has a different", key, "of", baseline.get(key), "instead of", summary[key], "so not comparing.")
+            return True
+    print("\n%-40s %10s %10s %8s" % ('Phase', 'Baseline', 'Now', 'Change'))
+    rows = [('Total CPU secs', baseline['total_secs'], summary['total_secs'])]
+    for phase in sorted(summary['phases'], key=lambda x: -summary['phases'][x]):
+        if phase in baseline['phases']:
+            rows.append((phase, baseline['phases'][phase], summary['phases'][phase]))
+    for name, before, now in rows[:16]:
+        print("%-40s %10.3f %10.3f %7.1f%%" % (name[:40], before, now, (now - before) * 100.0 / before if before else 0))
+    change = (summary['total_secs'] - baseline['total_secs']) / baseline['total_secs']
+    if change > tolerance:
+        print("\nREGRESSION: total compile time is %.1f%% slower than the baseline, which exceeds the tolerance of %.1f%%" % (change * 100, tolerance * 100))
+        return False
+    return True
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Benchmark the compile time cost of instantiating Outcome types.')
+    parser.add_argument('--compiler', default='g++', help='C++ compiler to use')
+    parser.add_argument('--types', type=int, default=200, help='number of distinct result and outcome types')
+    parser.add_argument('--call-sites', type=int, default=1000, help='number of functions constructing those types')
+    parser.add_argument('--std', default='c++17', help='C++ standard to compile with')
+    parser.add_argument('--repeat', type=int, default=3, help='number of builds, the quickest of which is reported')
+    parser.add_argument('--single-header', action='store_true', help='use single-header/outcome.hpp instead of include/outcome.hpp')
+    parser.add_argument('--baseline', help='JSON summary to compare against')
+    parser.add_argument('--tolerance', type=float, default=0.1, help='fractional slowdown against the baseline which fails')
+    parser.add_argument('--update-baseline', action='store_true', help='write the summary to --baseline instead of comparing')
+    args, extra = parser.parse_known_args()
+    flags = ['-std=' + args.std, '-O0'] + extra
+    header = single_header if args.single_header else os.path.join(include_dir, 'outcome.hpp')
+
+    cwd = tempfile.mkdtemp(prefix='instantiation-cost-')
+    try:
+        with open(os.path.join(cwd, 'instantiation.cpp'), 'wt') as oh:
+            oh.write(generate_source(args.types, args.call_sites, header))
+        best = None
+        for n in range(0, args.repeat):
+            print("Compiling", args.types, "types and", args.call_sites, "call sites with", args.compiler, "...")
+            secs, phases = measure(args.compiler, flags, cwd)
+            print("Build took %.2f secs CPU." % secs)
+            if best is None or secs < best[0]:
+                best = (secs, phases)
+    finally:
+        shutil.rmtree(cwd)
+
+    summary = {
+        'compiler': compiler_id(args.compiler),
+        'flags': flags[:2],
+        'header': 'single-header' if args.single_header else 'include',
+        'types': args.types,
+        'call_sites': args.call_sites,
+        'total_secs': round(best[0], 3),
+        'phases': best[1],
+    }
+    with open('results-instantiation-cost-' + sys.platform + '.json', 'wt') as oh:
+        json.dump(summary, oh, indent=2, sort_keys=True)
+    if args.baseline:
+        if args.update_baseline:
+            with open(args.baseline, 'wt') as oh:
+                json.dump(summary, oh, indent=2, sort_keys=True)
+                oh.write('\n')
+        elif os.path.exists(args.baseline):
+            with open(args.baseline, 'rt') as ih:
+                if not compare(summary, json.load(ih), args.tolerance):
+                    sys.exit(1)
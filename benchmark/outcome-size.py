@@ -0,0 +1,65 @@
+#!/usr/bin/python3
+# Report the size of outcome<T> with and without overlapped exception storage
+# (C) 2026 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2026
+#
+# Usage: outcome-size.py [--compiler g++] [--std c++17] [extra compiler args ...]
+#
+# A small program printing the size of result<T> and outcome<T> for a
+# selection of T is compiled twice, once with the default layout and once with
+# OUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE=1, and both are run. The results
+# are written into results-outcome-size-<platform>.csv. Pass the include path of
+# QuickCppLib as an extra compiler arg if it isn't installed.
+
+import sys, os, subprocess, argparse, tempfile, shutil
+
+here = os.path.dirname(os.path.abspath(__file__))
+include_dir = os.path.normpath(os.path.join(here, '..', 'include'))
+
+types = ['void', 'int', 'double', 'void *', 'std::string', 'std::vector<int>', 'std::unique_ptr<int>',
+         'std::shared_ptr<int>', 'std::function<void()>', 'std::map<int, int>']
+
+source = r'''#include "outcome.hpp"
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+namespace outcome = OUTCOME_V2_NAMESPACE;
+int main()
+{
+%s
+  return 0;
+}
+''' % '\n'.join('  printf("%%zu,%%zu\\n", sizeof(outcome::result<%s>), sizeof(outcome::outcome<%s>));' % (t, t) for t in types)
+
+def sizes(compiler, flags, cwd, overlapped):
+    "Returns a list of (sizeof result<T>, sizeof outcome<T>) for each of types"
+    exe = os.path.join(cwd, 'outcome-size-%d' % overlapped)
+    subprocess.check_call([compiler] + flags + ['-DOUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE=%d' % overlapped, '-o', exe, 'outcome-size.cpp'], cwd=cwd)
+    out = subprocess.check_output([exe]).decode('utf-8')
+    return [tuple(int(x) for x in line.split(',')) for line in out.splitlines()]
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Report the size of outcome<T> with and without overlapped exception storage.')
+    parser.add_argument('--compiler', default='g++', help='C++ compiler to use')
+    parser.add_argument('--std', default='c++17', help='C++ standard to compile with')
+    args, extra = parser.parse_known_args()
+    flags = ['-std=' + args.std, '-I' + include_dir] + extra
+
+    cwd = tempfile.mkdtemp(prefix='outcome-size-')
+    try:
+        with open(os.path.join(cwd, 'outcome-size.cpp'), 'wt') as oh:
+            oh.write(source)
+        separate = sizes(args.compiler, flags, cwd, 0)
+        overlapped = sizes(args.compiler, flags, cwd, 1)
+    finally:
+        shutil.rmtree(cwd)
+
+    with open('results-outcome-size-' + sys.platform + '.csv', 'wt') as resultsh:
+        resultsh.write('"T","result<T>","outcome<T>","outcome<T> overlapped"\n')
+        print("%-25s %10s %10s %20s" % ('T', 'result<T>', 'outcome<T>', 'outcome<T> overlapped'))
+        for t, (r, o), (_, oo) in zip(types, separate, overlapped):
+            print("%-25s %10d %10d %20d" % (t, r, o, oo))
+            resultsh.write('"%s",%d,%d,%d\n' % (t, r, o, oo))
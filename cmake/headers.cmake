@@ -6,23 +6,28 @@ set(outcome_HEADERS
   "include/outcome/basic_result.hpp"
   "include/outcome/boost_outcome.hpp"
   "include/outcome/boost_result.hpp"
+  "include/outcome/catching.hpp"
+  "include/outcome/circuit_breaker.hpp"
   "include/outcome/config.hpp"
   "include/outcome/convert.hpp"
   "include/outcome/coroutine_support.hpp"
   "include/outcome/detail/basic_outcome_exception_observers.hpp"
   "include/outcome/detail/basic_outcome_exception_observers_impl.hpp"
+  "include/outcome/detail/basic_outcome_exception_storage.hpp"
   "include/outcome/detail/basic_outcome_failure_observers.hpp"
   "include/outcome/detail/basic_result_error_observers.hpp"
   "include/outcome/detail/basic_result_final.hpp"
   "include/outcome/detail/basic_result_storage.hpp"
   "include/outcome/detail/basic_result_value_observers.hpp"
   "include/outcome/detail/coroutine_support.ipp"
+  "include/outcome/detail/failure_exception_cache.hpp"
   "include/outcome/detail/revision.hpp"
   "include/outcome/detail/trait_std_error_code.hpp"
   "include/outcome/detail/trait_std_exception.hpp"
   "include/outcome/detail/try.h"
   "include/outcome/detail/value_storage.hpp"
   "include/outcome/detail/version.hpp"
+  "include/outcome/experimental/catching.hpp"
   "include/outcome/experimental/coroutine_support.hpp"
   "include/outcome/experimental/result.h"
   "include/outcome/experimental/status-code/include/status-code/boost_error_code.hpp"
@@ -53,10 +58,12 @@ set(outcome_HEADERS
   "include/outcome/experimental/status-code/single-header/system_error2.hpp"
   "include/outcome/experimental/status_outcome.hpp"
   "include/outcome/experimental/status_result.hpp"
+  "include/outcome/hash_support.hpp"
   "include/outcome/iostream_support.hpp"
   "include/outcome/outcome.hpp"
   "include/outcome/outcome.natvis"
   "include/outcome/outcome_gdb.h"
+  "include/outcome/partial_result.hpp"
   "include/outcome/policy/all_narrow.hpp"
   "include/outcome/policy/base.hpp"
   "include/outcome/policy/fail_to_compile_observers.hpp"
@@ -67,6 +74,11 @@ set(outcome_HEADERS
   "include/outcome/policy/terminate.hpp"
   "include/outcome/policy/throw_bad_result_access.hpp"
   "include/outcome/result.hpp"
+  "include/outcome/result_cache.hpp"
+  "include/outcome/result_fwd.hpp"
+  "include/outcome/retry.hpp"
+  "include/outcome/shared_result.hpp"
+  "include/outcome/single_flight.hpp"
   "include/outcome/std_outcome.hpp"
   "include/outcome/std_result.hpp"
   "include/outcome/success_failure.hpp"
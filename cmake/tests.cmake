@@ -1,19 +1,26 @@
 # DO NOT EDIT, GENERATED BY SCRIPT
 set(outcome_TESTS
   "test/expected-pass.cpp"
+  "test/single-header-result-test.cpp"
   "test/single-header-test.cpp"
+  "test/tests/catching.cpp"
+  "test/tests/circuit-breaker.cpp"
   "test/tests/comparison.cpp"
   "test/tests/constexpr.cpp"
   "test/tests/containers.cpp"
   "test/tests/core-outcome.cpp"
   "test/tests/core-result.cpp"
+  "test/tests/coroutine-support-halo.cpp"
   "test/tests/coroutine-support.cpp"
   "test/tests/default-construction.cpp"
   "test/tests/experimental-c-result.cpp"
   "test/tests/experimental-core-outcome-status.cpp"
   "test/tests/experimental-core-result-status.cpp"
   "test/tests/experimental-p0709a.cpp"
+  "test/tests/experimental-posix.cpp"
+  "test/tests/failure-exception-cache.cpp"
   "test/tests/fileopen.cpp"
+  "test/tests/hashing.cpp"
   "test/tests/hooks.cpp"
   "test/tests/issue0007.cpp"
   "test/tests/issue0009.cpp"
@@ -39,8 +46,15 @@ set(outcome_TESTS
   "test/tests/issue0259.cpp"
   "test/tests/issue0291.cpp"
   "test/tests/noexcept-propagation.cpp"
+  "test/tests/overlapped-exception-storage.cpp"
+  "test/tests/partial-result.cpp"
   "test/tests/propagate.cpp"
+  "test/tests/result-cache.cpp"
+  "test/tests/result-fwd.cpp"
+  "test/tests/retry.cpp"
   "test/tests/serialisation.cpp"
+  "test/tests/shared-result.cpp"
+  "test/tests/single-flight.cpp"
   "test/tests/success-failure.cpp"
   "test/tests/swap.cpp"
   "test/tests/udts.cpp"
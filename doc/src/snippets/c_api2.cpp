@@ -91,11 +91,43 @@ result test2(int x)
 }
 //! [try]
 
+//! [try_goto]
+result test3(int x, int y)
+{
+  result ret = SUCCESS(0);
+  int *a = (int *) malloc(sizeof(int)), *b = NULL;
+  intptr_t v;
+  if(a == NULL)
+  {
+    return CXX_MAKE_RESULT_SYSTEM_FAILURE_POSIX(result_int, ENOMEM);
+  }
+  CXX_RESULT_SYSTEM_TRY_GOTO(*a, ret, free_a, positive_only(x));  // where to jump if unsuccessful
+  b = (int *) malloc(sizeof(int));
+  if(b == NULL)
+  {
+    ret = CXX_MAKE_RESULT_SYSTEM_FAILURE_POSIX(result_int, ENOMEM);
+    goto free_a;
+  }
+  CXX_RESULT_SYSTEM_TRY_GOTO(v, ret, free_b, positive_only(y));
+  *b = (int) v;
+  ret = SUCCESS(*a + *b);
+free_b:
+  free(b);
+free_a:
+  free(a);
+  return ret;
+}
+//! [try_goto]
+
 int main(void)
 {
   if(!test(0))
     abort();
   if(test(-1))
     abort();
+  if(CXX_RESULT_HAS_ERROR(test3(1, 2)) || test3(1, 2).value != 3)
+    abort();
+  if(CXX_RESULT_HAS_VALUE(test3(1, -2)))
+    abort();
   return 0;
 }
@@ -0,0 +1,38 @@
+module;
+#include "outcome/detail/global_module_fragment.hpp"
+
+// Tell the headers we are generating the interface for the library
+#define GENERATING_OUTCOME_MODULE_INTERFACE
+
+// The TRY macros and the types they use live in the global module, as importers
+// must include outcome/try.hpp for the macros anyway
+#include "outcome/try.hpp"
+
+// status-code is not part of this module, so it must be in the global module too
+#ifndef SYSTEM_ERROR2_USE_STD_ADDRESSOF
+#if OUTCOME_USE_STD_ADDRESSOF
+#define SYSTEM_ERROR2_USE_STD_ADDRESSOF 1
+#endif
+#endif
+#if !OUTCOME_USE_SYSTEM_STATUS_CODE && __has_include("outcome/experimental/status-code/include/status-code/system_error2.hpp")
+#include "outcome/experimental/status-code/include/status-code/system_error2.hpp"
+#elif !OUTCOME_USE_SYSTEM_STATUS_CODE && __has_include("status-code/include/status-code/system_error2.hpp")
+#include "status-code/include/status-code/system_error2.hpp"
+#else
+#include <status-code/system_error2.hpp>
+#endif
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+export module OUTCOME_V2_CXX_EXPERIMENTAL_MODULE_NAME;
+#undef OUTCOME_V2_CXX_MODULE_EXPORT
+#define OUTCOME_V2_CXX_MODULE_EXPORT export
+#include "outcome.hpp"
+#include "outcome/experimental/status_outcome.hpp"
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+#include "outcome/experimental/posix.hpp"
+#endif
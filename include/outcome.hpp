@@ -24,6 +24,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #if !OUTCOME_ENABLE_CXX_MODULES || !defined(__cpp_modules) || defined(GENERATING_OUTCOME_MODULE_INTERFACE) || OUTCOME_DISABLE_CXX_MODULES
 #include "outcome/coroutine_support.hpp"
+#include "outcome/hash_support.hpp"
 #include "outcome/iostream_support.hpp"
 #include "outcome/try.hpp"
 #else
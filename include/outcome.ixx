@@ -1,11 +1,14 @@
 module;
-#include <__msvc_all_public_headers.hpp>
-// *** Everything before here is replaced by cmake!
+#include "outcome/detail/global_module_fragment.hpp"
 
 // Tell the headers we are generating the interface for the library
 #define GENERATING_OUTCOME_MODULE_INTERFACE
 
+// The TRY macros and the types they use live in the global module, as importers
+// must include outcome/try.hpp for the macros anyway
 #include "outcome/try.hpp"
 
 export module OUTCOME_V2_CXX_MODULE_NAME;
+#undef OUTCOME_V2_CXX_MODULE_EXPORT
+#define OUTCOME_V2_CXX_MODULE_EXPORT export
 #include "outcome.hpp"
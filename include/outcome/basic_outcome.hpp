@@ -30,6 +30,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include "basic_result.hpp"
 
 #include "detail/basic_outcome_exception_observers.hpp"
+#include "detail/basic_outcome_exception_storage.hpp"
 #include "detail/basic_outcome_failure_observers.hpp"
 
 #ifdef __clang__
@@ -183,7 +184,7 @@ template <class T> using is_basic_outcome = detail::is_basic_outcome<std::decay_
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
+template <class T> constexpr bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
 
 namespace concepts
 {
@@ -216,7 +217,7 @@ namespace concepts
     inline OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, NVP> match_basic_outcome(OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, NVP> &&, T &&);
 
     template <class U>
-    static constexpr bool basic_outcome =
+    constexpr bool basic_outcome =
     OUTCOME_V2_NAMESPACE::is_basic_outcome<U>::value ||
     !std::is_same<no_match, decltype(match_basic_outcome(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>(),
                                                          std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
@@ -224,7 +225,7 @@ namespace concepts
   /* The `basic_outcome` concept.
   \requires That `U` matches a `basic_outcome`.
   */
-  template <class U> static constexpr bool basic_outcome = detail::basic_outcome<U>;
+  template <class U> constexpr bool basic_outcome = detail::basic_outcome<U>;
 #endif
 }  // namespace concepts
 
@@ -248,13 +249,17 @@ class OUTCOME_NODISCARD basic_outcome
       public detail::basic_result_final<R, S, NoValuePolicy>
 #else
     : public detail::select_basic_outcome_failure_observers<
-      detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>
+      detail::basic_outcome_exception_observers<
+      detail::select_basic_outcome_exception_storage<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P>, R, S, P, NoValuePolicy>,
+      R, S, P, NoValuePolicy>
 #endif
 {
   static_assert(trait::type_can_be_used_in_basic_result<P>, "The exception_type cannot be used");
   static_assert(std::is_void<P>::value || std::is_default_constructible<P>::value, "exception_type must be void or default constructible");
   using base = detail::select_basic_outcome_failure_observers<
-  detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>;
+  detail::basic_outcome_exception_observers<detail::select_basic_outcome_exception_storage<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P>, R, S,
+                                            P, NoValuePolicy>,
+  R, S, P, NoValuePolicy>;
   friend struct policy::base;
   template <class T, class U, class V, class W>  //
   friend class basic_outcome;
@@ -424,9 +429,6 @@ public:
   using exception_type_if_enabled = std::conditional_t<std::is_same<exception_type, value_type>::value || std::is_same<exception_type, error_type>::value,
                                                        disable_in_place_exception_type, exception_type>;
 
-protected:
-  detail::devoid<exception_type> _ptr;
-
 public:
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -453,7 +455,6 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(T &&t, value_converting_constructor_tag /*unused*/ = value_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<value_type, T>)  // NOLINT
       : base{in_place_type<typename base::_value_type>, static_cast<T &&>(t)}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(t));
   }
@@ -465,7 +466,6 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(T &&t, error_converting_constructor_tag /*unused*/ = error_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, static_cast<T &&>(t)}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(t));
   }
@@ -488,8 +488,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_exception_converting_constructor<T>))
   constexpr basic_outcome(T &&t, exception_converting_constructor_tag /*unused*/ = exception_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<exception_type, T>)  // NOLINT
-      : base()
-      , _ptr(static_cast<T &&>(t))
+      : base{detail::exception_construction_tag(), static_cast<T &&>(t)}
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(t));
@@ -501,8 +500,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_error_exception_converting_constructor<T, U>))
   constexpr basic_outcome(T &&a, U &&b, error_exception_converting_constructor_tag /*unused*/ = error_exception_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T> && detail::is_nothrow_constructible<exception_type, U>)  // NOLINT
-      : base{in_place_type<typename base::_error_type>, static_cast<T &&>(a)}
-      , _ptr(static_cast<U &&>(b))
+      : base{detail::failure_construction_tag(), true, static_cast<U &&>(b), in_place_type<typename base::_error_type>, static_cast<T &&>(a)}
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(a), static_cast<U &&>(b));
@@ -530,8 +528,8 @@ SIGNATURE NOT RECOGNISED
   explicit_compatible_copy_conversion_tag /*unused*/ = explicit_compatible_copy_conversion_tag()) noexcept(detail::is_nothrow_constructible<value_type, T> &&
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type, V>)
-      : base{typename base::compatible_conversion_tag(), o}
-      , _ptr(o._ptr)
+      : base{detail::failure_construction_tag(), o.has_exception(), o.has_exception() ? o._ptr() : std::decay_t<decltype(o._ptr())>(),
+             typename base::compatible_conversion_tag(), o}
   {
     no_value_policy_type::on_outcome_copy_construction(this, o);
   }
@@ -545,8 +543,9 @@ SIGNATURE NOT RECOGNISED
   explicit_compatible_move_conversion_tag /*unused*/ = explicit_compatible_move_conversion_tag()) noexcept(detail::is_nothrow_constructible<value_type, T> &&
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type, V>)
-      : base{typename base::compatible_conversion_tag(), static_cast<basic_outcome<T, U, V, W> &&>(o)}
-      , _ptr(static_cast<typename basic_outcome<T, U, V, W>::exception_type &&>(o._ptr))
+      : base{detail::failure_construction_tag(), o.has_exception(),
+             o.has_exception() ? static_cast<basic_outcome<T, U, V, W> &&>(o)._ptr() : std::decay_t<decltype(o._ptr())>(),
+             typename base::compatible_conversion_tag(), static_cast<basic_outcome<T, U, V, W> &&>(o)}
   {
     no_value_policy_type::on_outcome_move_construction(this, static_cast<basic_outcome<T, U, V, W> &&>(o));
   }
@@ -561,7 +560,6 @@ SIGNATURE NOT RECOGNISED
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type>)
       : base{typename base::compatible_conversion_tag(), o}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_copy_construction(this, o);
   }
@@ -576,7 +574,6 @@ SIGNATURE NOT RECOGNISED
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type>)
       : base{typename base::compatible_conversion_tag(), static_cast<basic_result<T, U, V> &&>(o)}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
   }
@@ -591,7 +588,6 @@ SIGNATURE NOT RECOGNISED
                                                                                                        noexcept(make_error_code(std::declval<U>())) &&
                                                                                                        detail::is_nothrow_constructible<exception_type>)
       : base{typename base::make_error_code_compatible_conversion_tag(), o}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_copy_construction(this, o);
   }
@@ -606,7 +602,6 @@ SIGNATURE NOT RECOGNISED
                                                                                                        noexcept(make_error_code(std::declval<U>())) &&
                                                                                                        detail::is_nothrow_constructible<exception_type>)
       : base{typename base::make_error_code_compatible_conversion_tag(), static_cast<basic_result<T, U, V> &&>(o)}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
   }
@@ -619,7 +614,6 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<Args...>))
   constexpr explicit basic_outcome(in_place_type_t<value_type_if_enabled> _, Args &&...args) noexcept(detail::is_nothrow_constructible<value_type, Args...>)
       : base{_, static_cast<Args &&>(args)...}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<value_type>, static_cast<Args &&>(args)...);
   }
@@ -631,7 +625,6 @@ SIGNATURE NOT RECOGNISED
   constexpr explicit basic_outcome(in_place_type_t<value_type_if_enabled> _, std::initializer_list<U> il,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<value_type, std::initializer_list<U>, Args...>)
       : base{_, il, static_cast<Args &&>(args)...}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<value_type>, il, static_cast<Args &&>(args)...);
   }
@@ -642,7 +635,6 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<Args...>))
   constexpr explicit basic_outcome(in_place_type_t<error_type_if_enabled> _, Args &&...args) noexcept(detail::is_nothrow_constructible<error_type, Args...>)
       : base{_, static_cast<Args &&>(args)...}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<error_type>, static_cast<Args &&>(args)...);
   }
@@ -654,7 +646,6 @@ SIGNATURE NOT RECOGNISED
   constexpr explicit basic_outcome(in_place_type_t<error_type_if_enabled> _, std::initializer_list<U> il,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<error_type, std::initializer_list<U>, Args...>)
       : base{_, il, static_cast<Args &&>(args)...}
-      , _ptr()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<error_type>, il, static_cast<Args &&>(args)...);
   }
@@ -665,8 +656,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_exception_constructor<Args...>))
   constexpr explicit basic_outcome(in_place_type_t<exception_type_if_enabled> /*unused*/,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<exception_type, Args...>)
-      : base()
-      , _ptr(static_cast<Args &&>(args)...)
+      : base{detail::exception_construction_tag(), static_cast<Args &&>(args)...}
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<exception_type>, static_cast<Args &&>(args)...);
@@ -678,8 +668,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_exception_constructor<std::initializer_list<U>, Args...>))
   constexpr explicit basic_outcome(in_place_type_t<exception_type_if_enabled> /*unused*/, std::initializer_list<U> il,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<exception_type, std::initializer_list<U>, Args...>)
-      : base()
-      , _ptr(il, static_cast<Args &&>(args)...)
+      : base{detail::exception_construction_tag(), il, static_cast<Args &&>(args)...}
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<exception_type>, il, static_cast<Args &&>(args)...);
@@ -737,7 +726,6 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(const failure_type<T> &o,
                           error_failure_tag /*unused*/ = error_failure_tag()) noexcept(detail::is_nothrow_constructible<error_type, T>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(o)}
-      , _ptr()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -749,8 +737,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<T>::value && predicate::template enable_compatible_conversion<void, void, T, void>))
   constexpr basic_outcome(const failure_type<T> &o,
                           exception_failure_tag /*unused*/ = exception_failure_tag()) noexcept(detail::is_nothrow_constructible<exception_type, T>)  // NOLINT
-      : base()
-      , _ptr(detail::extract_exception_from_failure<exception_type>(o))
+      : base{detail::exception_construction_tag(), detail::extract_exception_from_failure<exception_type>(o)}
   {
     this->_state._status.set_have_exception(true);
     hooks::set_spare_storage(this, o.spare_storage());
@@ -765,7 +752,6 @@ SIGNATURE NOT RECOGNISED
                           explicit_make_error_code_compatible_copy_conversion_tag /*unused*/ =
                           explicit_make_error_code_compatible_copy_conversion_tag()) noexcept(noexcept(make_error_code(std::declval<T>())))  // NOLINT
       : base{in_place_type<typename base::_error_type>, make_error_code(detail::extract_error_from_failure<error_type>(o))}
-      , _ptr()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -777,8 +763,8 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<U>::value && predicate::template enable_compatible_conversion<void, T, U, void>))
   constexpr basic_outcome(const failure_type<T, U> &o, explicit_compatible_copy_conversion_tag /*unused*/ = explicit_compatible_copy_conversion_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T> && detail::is_nothrow_constructible<exception_type, U>)  // NOLINT
-      : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(o)}
-      , _ptr(detail::extract_exception_from_failure<exception_type>(o))
+      : base{detail::failure_construction_tag(), o.has_exception(), detail::extract_exception_from_failure<exception_type>(o),
+             in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(o)}
   {
     if(!o.has_error())
     {
@@ -800,7 +786,6 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(failure_type<T> &&o,
                           error_failure_tag /*unused*/ = error_failure_tag()) noexcept(detail::is_nothrow_constructible<error_type, T>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(static_cast<failure_type<T> &&>(o))}
-      , _ptr()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -812,8 +797,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<T>::value && predicate::template enable_compatible_conversion<void, void, T, void>))
   constexpr basic_outcome(failure_type<T> &&o,
                           exception_failure_tag /*unused*/ = exception_failure_tag()) noexcept(detail::is_nothrow_constructible<exception_type, T>)  // NOLINT
-      : base()
-      , _ptr(detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T> &&>(o)))
+      : base{detail::exception_construction_tag(), detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T> &&>(o))}
   {
     this->_state._status.set_have_exception(true);
     hooks::set_spare_storage(this, o.spare_storage());
@@ -828,7 +812,6 @@ SIGNATURE NOT RECOGNISED
                           explicit_make_error_code_compatible_move_conversion_tag /*unused*/ =
                           explicit_make_error_code_compatible_move_conversion_tag()) noexcept(noexcept(make_error_code(std::declval<T>())))  // NOLINT
       : base{in_place_type<typename base::_error_type>, make_error_code(detail::extract_error_from_failure<error_type>(static_cast<failure_type<T> &&>(o)))}
-      , _ptr()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -840,8 +823,9 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<U>::value && predicate::template enable_compatible_conversion<void, T, U, void>))
   constexpr basic_outcome(failure_type<T, U> &&o, explicit_compatible_move_conversion_tag /*unused*/ = explicit_compatible_move_conversion_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T> && detail::is_nothrow_constructible<exception_type, U>)  // NOLINT
-      : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(static_cast<failure_type<T, U> &&>(o))}
-      , _ptr(detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T, U> &&>(o)))
+      : base{detail::failure_construction_tag(), o.has_exception(),
+             detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T, U> &&>(o)), in_place_type<typename base::_error_type>,
+             detail::extract_error_from_failure<error_type>(static_cast<failure_type<T, U> &&>(o))}
   {
     if(!o.has_error())
     {
@@ -879,7 +863,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error == o._state._error && this->_ptr == o._ptr;
+      return this->_state._error == o._state._error && this->_ptr() == o._ptr();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -887,7 +871,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr == o._ptr;
+      return this->_ptr() == o._ptr();
     }
     return false;
   }
@@ -903,7 +887,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error == o.error() && this->_ptr == o.exception();
+      return this->_state._error == o.error() && this->_ptr() == o.exception();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -911,7 +895,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr == o.exception();
+      return this->_ptr() == o.exception();
     }
     return false;
   }
@@ -934,7 +918,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error != o._state._error || this->_ptr != o._ptr;
+      return this->_state._error != o._state._error || this->_ptr() != o._ptr();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -942,7 +926,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr != o._ptr;
+      return this->_ptr() != o._ptr();
     }
     return true;
   }
@@ -958,7 +942,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error != o.error() || this->_ptr != o.exception();
+      return this->_state._error != o.error() || this->_ptr() != o.exception();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -966,7 +950,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr != o.exception();
+      return this->_ptr() != o.exception();
     }
     return true;
   }
@@ -978,6 +962,11 @@ SIGNATURE NOT RECOGNISED
                                                  && (std::is_void<error_type>::value || detail::is_nothrow_swappable<error_type>::value)  //
                                                  && (std::is_void<exception_type>::value || detail::is_nothrow_swappable<exception_type>::value))
   {
+    if(this->_swap_overlapped(o))
+    {
+      // The exceptions were stored within the values, so have been swapped along with them
+      return;
+    }
 #ifdef __cpp_exceptions
     constexpr bool value_throws = !std::is_void<value_type>::value && !detail::is_nothrow_swappable<value_type>::value;
     constexpr bool error_throws = !std::is_void<error_type>::value && !detail::is_nothrow_swappable<error_type>::value;
@@ -991,7 +980,7 @@ SIGNATURE NOT RECOGNISED
       // Simples
       this->_state.swap(o._state);
       using std::swap;
-      swap(this->_ptr, o._ptr);
+      swap(this->_ptr(), o._ptr());
       return;
     }
     struct some_type
@@ -1013,7 +1002,7 @@ SIGNATURE NOT RECOGNISED
           // The value + error swap threw an exception. Try to swap back _ptr
           try
           {
-            strong_swap(this->all_good, this->a._ptr, this->b._ptr);
+            strong_swap(this->all_good, this->a._ptr(), this->b._ptr());
           }
           catch(...)
           {
@@ -1042,7 +1031,7 @@ SIGNATURE NOT RECOGNISED
         }
       }
     } some_type_value{*this, o};
-    strong_swap(some_type_value.all_good, this->_ptr, o._ptr);
+    strong_swap(some_type_value.all_good, this->_ptr(), o._ptr());
     some_type_value.exceptioned = true;
     this->_state.swap(o._state);
     some_type_value.exceptioned = false;
@@ -1052,7 +1041,7 @@ SIGNATURE NOT RECOGNISED
 #else
     this->_state.swap(o._state);
     using std::swap;
-    swap(this->_ptr, o._ptr);
+    swap(this->_ptr(), o._ptr());
 #endif
   }
 
@@ -1137,7 +1126,7 @@ SIGNATURE NOT RECOGNISED
   template <class R, class S, class P, class NoValuePolicy, class U>
   constexpr inline void override_outcome_exception(basic_outcome<R, S, P, NoValuePolicy> *o, U &&v) noexcept
   {
-    o->_ptr = static_cast<U &&>(v);  // NOLINT
+    o->_set_ptr(static_cast<U &&>(v));  // NOLINT
     o->_state._status.set_have_exception(true);
   }
 }  // namespace hooks
@@ -50,7 +50,9 @@ class basic_result;
 
 namespace detail
 {
-  // These are reused by basic_outcome to save load on the compiler
+  // These are reused by basic_outcome to save load on the compiler. They are deliberately not C++ 20 concepts:
+  // constraining the constructors on concepts instead was measured with benchmark/instantiation-cost.py, and
+  // GCC 12 compiled no faster.
   template <class value_type, class error_type> struct result_predicates
   {
     // Predicate for the implicit constructors to be available. Weakened to allow result<int, C enum>.
@@ -185,7 +187,7 @@ template <class T> using is_basic_result = detail::is_basic_result<std::decay_t<
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
+template <class T> constexpr bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
 
 namespace concepts
 {
@@ -213,14 +215,14 @@ namespace concepts
     inline OUTCOME_V2_NAMESPACE::basic_result<R, S, NVP> match_basic_result(OUTCOME_V2_NAMESPACE::basic_result<R, S, NVP> &&, T &&);
 
     template <class U>
-    static constexpr bool basic_result = OUTCOME_V2_NAMESPACE::is_basic_result<U>::value ||
+    constexpr bool basic_result = OUTCOME_V2_NAMESPACE::is_basic_result<U>::value ||
                                          !std::is_same<no_match, decltype(match_basic_result(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>(),
                                                                                              std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
   }  // namespace detail
   /* The `basic_result` concept.
   \requires That `U` matches a `basic_result`.
   */
-  template <class U> static constexpr bool basic_result = detail::basic_result<U>;
+  template <class U> constexpr bool basic_result = detail::basic_result<U>;
 #endif
 }  // namespace concepts
 
@@ -29,6 +29,15 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "boost_result.hpp"
 
+#if OUTCOME_ENABLE_FAILURE_EXCEPTION_CACHE
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  struct boost_error_code_exceptions;
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+#endif
+
 #ifndef BOOST_SYSTEM_BASIC_OUTCOME_FAILURE_EXCEPTION_FROM_ERROR
 #define BOOST_SYSTEM_BASIC_OUTCOME_FAILURE_EXCEPTION_FROM_ERROR
 namespace boost
@@ -38,7 +47,13 @@ namespace boost
     // Implement the .failure() observer.
     inline boost::exception_ptr basic_outcome_failure_exception_from_error(const boost::system::error_code &ec)
     {
+#if OUTCOME_ENABLE_FAILURE_EXCEPTION_CACHE
+      using cache = OUTCOME_V2_NAMESPACE::detail::failure_exception_cache<OUTCOME_V2_NAMESPACE::detail::boost_error_code_exceptions, boost::exception_ptr>;
+      return cache::get().lookup(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&ec.category())), ec.value(),
+                                 [&] { return boost::copy_exception(boost::system::system_error(ec)); });
+#else
       return boost::copy_exception(boost::system::system_error(ec));
+#endif
     }
   }  // namespace system
 }  // namespace boost
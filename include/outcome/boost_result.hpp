@@ -101,6 +101,14 @@ namespace detail
     state._status.set_have_error_is_errno(true);
   }
 
+  // Customise _errno_value, only ever called if have_error_is_errno
+  template <class State> inline int _errno_value(const State & /*unused*/, const boost::system::error_code &error) noexcept { return error.value(); }
+  template <class State> inline int _errno_value(const State & /*unused*/, const boost::system::error_condition &error) noexcept { return error.value(); }
+  template <class State> constexpr inline int _errno_value(const State & /*unused*/, const boost::system::errc::errc_t &error) noexcept
+  {
+    return static_cast<int>(error);
+  }
+
 }  // namespace detail
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
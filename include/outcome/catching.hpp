@@ -0,0 +1,258 @@
+/* Calling of throwing callables at a boundary returning outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_CATCHING_HPP
+#define OUTCOME_CATCHING_HPP
+
+#include "outcome.hpp"
+#include "utils.hpp"
+
+#include <exception>
+#include <system_error>
+#include <tuple>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Exception, class Mapper> struct exception_mapping_entry
+{
+  using exception_type = Exception;
+  Mapper mapper;
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Exception, class Mapper> constexpr inline exception_mapping_entry<Exception, std::decay_t<Mapper>> map_exception(Mapper &&mapper)
+{
+  return {static_cast<Mapper &&>(mapper)};
+}
+
+namespace detail
+{
+  // A mapper is either a callable taking the exception and returning the error, or the error
+  template <class Result, class M, class X> inline auto apply_exception_mapper(const M &m, const X &e, int /*unused*/) -> decltype(Result(failure(m(e))))
+  {
+    return Result(failure(m(e)));
+  }
+  template <class Result, class M, class X> inline Result apply_exception_mapper(const M &m, const X & /*unused*/, ...) { return Result(failure(m)); }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class... Entries> class exception_mapping
+{
+  static constexpr size_t _count = sizeof...(Entries);
+  std::tuple<Entries...> _entries;
+
+#ifdef __cpp_exceptions
+  template <class Result> Result _match(std::integral_constant<size_t, _count> /*unused*/) const { throw; }
+  template <class Result, size_t I> Result _match(std::integral_constant<size_t, I> /*unused*/) const
+  {
+    // The innermost handler sees the exception first, so the entries are nested in reverse
+    using entry_type = std::tuple_element_t<_count - 1 - I, std::tuple<Entries...>>;
+    try
+    {
+      return _match<Result>(std::integral_constant<size_t, I + 1>());
+    }
+    catch(const typename entry_type::exception_type &e)
+    {
+      return detail::apply_exception_mapper<Result>(std::get<_count - 1 - I>(_entries).mapper, e, 0);
+    }
+  }
+#endif
+
+public:
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  constexpr explicit exception_mapping(Entries... entries)
+      : _entries(static_cast<Entries &&>(entries)...)
+  {
+  }
+
+#ifdef __cpp_exceptions
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class Result> Result map() const { return _match<Result>(std::integral_constant<size_t, 0>()); }
+#endif
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class... Entries> constexpr inline exception_mapping<Entries...> make_exception_mapping(Entries... entries)
+{
+  return exception_mapping<Entries...>(static_cast<Entries &&>(entries)...);
+}
+
+namespace trait
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class EC> struct exception_to_error
+  {
+    static constexpr bool value = false;
+  };
+#ifdef __cpp_exceptions
+  template <> struct exception_to_error<std::error_code>
+  {
+    static constexpr bool value = true;
+    // Returns the error matching the exception being handled, or that for unmatched exceptions
+    static std::error_code make(bool &matched) noexcept
+    {
+      std::error_code ec = error_from_exception(std::current_exception(), {});
+      matched = !!ec;
+      return matched ? ec : std::make_error_code(std::errc::resource_unavailable_try_again);
+    }
+  };
+#endif
+}  // namespace trait
+
+namespace detail
+{
+  template <class T> struct is_exception_mapping
+  {
+    static constexpr bool value = false;
+  };
+  template <class... Entries> struct is_exception_mapping<exception_mapping<Entries...>>
+  {
+    static constexpr bool value = true;
+  };
+
+  template <class Result, class F, class... Args> struct catching_result
+  {
+    using type = Result;
+  };
+  template <class F, class... Args> struct catching_result<void, F, Args...>
+  {
+    using type = outcome<std::decay_t<decltype(std::declval<F>()(std::declval<Args>()...))>>;
+  };
+  template <class Result, class F, class... Args> using catching_result_t = typename catching_result<Result, F, Args...>::type;
+
+  template <class Result, class F, class... Args> inline OUTCOME_FORCEINLINE Result catching_invoke(std::true_type /*is void*/, F &&f, Args &&...args)
+  {
+    static_cast<F &&>(f)(static_cast<Args &&>(args)...);
+    return Result(in_place_type<void>);
+  }
+  template <class Result, class F, class... Args> inline OUTCOME_FORCEINLINE Result catching_invoke(std::false_type /*is void*/, F &&f, Args &&...args)
+  {
+    return Result(in_place_type<typename Result::value_type>, static_cast<F &&>(f)(static_cast<Args &&>(args)...));
+  }
+
+#ifdef __cpp_exceptions
+  template <class T> using catching_exception_type = typename T::exception_type;
+
+  // For exceptions not in the mapping, whose handler is still active
+  template <class Result, bool has_exception = trait::detail::is_detected<catching_exception_type, Result>::value,
+            bool has_translation = trait::exception_to_error<typename Result::error_type>::value>
+  struct catching_unmatched
+  {
+    static_assert(has_exception || has_translation,
+                  "catching() needs Result to have an exception type, or trait::exception_to_error to be specialised for its error type");
+  };
+  template <class Result> struct catching_unmatched<Result, true, true>
+  {
+    static Result make() noexcept
+    {
+      bool matched = false;
+      auto ec = trait::exception_to_error<typename Result::error_type>::make(matched);
+      if(matched)
+      {
+        return Result(in_place_type<typename Result::error_type>, static_cast<decltype(ec) &&>(ec));
+      }
+      return Result(in_place_type<typename Result::exception_type>, std::current_exception());
+    }
+  };
+  template <class Result> struct catching_unmatched<Result, true, false>
+  {
+    static Result make() noexcept { return Result(in_place_type<typename Result::exception_type>, std::current_exception()); }
+  };
+  template <class Result> struct catching_unmatched<Result, false, true>
+  {
+    static Result make() noexcept
+    {
+      bool matched = false;
+      auto ec = trait::exception_to_error<typename Result::error_type>::make(matched);
+      return Result(in_place_type<typename Result::error_type>, static_cast<decltype(ec) &&>(ec));
+    }
+  };
+
+  // Kept out of line, so the try block costs its caller nothing
+  template <class Result, class Mapping> inline OUTCOME_NOINLINE Result catching_failure(const Mapping &mapping) noexcept
+  {
+    try
+    {
+      return mapping.template map<Result>();
+    }
+    catch(...)
+    {
+      return catching_unmatched<Result>::make();
+    }
+  }
+  template <class Result> inline OUTCOME_NOINLINE Result catching_failure(const exception_mapping<> & /*unused*/) noexcept { return catching_unmatched<Result>::make(); }
+#endif
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Result = void, class... Entries, class F, class... Args>
+inline OUTCOME_FORCEINLINE auto catching(const exception_mapping<Entries...> &mapping, F &&f, Args &&...args) noexcept -> detail::catching_result_t<Result, F, Args...>
+{
+  using result_type = detail::catching_result_t<Result, F, Args...>;
+  using is_void = std::is_void<typename result_type::value_type>;
+#ifdef __cpp_exceptions
+  try
+  {
+    return detail::catching_invoke<result_type>(is_void(), static_cast<F &&>(f), static_cast<Args &&>(args)...);
+  }
+  catch(...)
+  {
+    return detail::catching_failure<result_type>(mapping);
+  }
+#else
+  (void) mapping;
+  return detail::catching_invoke<result_type>(is_void(), static_cast<F &&>(f), static_cast<Args &&>(args)...);
+#endif
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(class Result = void, class F, class... Args)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(!detail::is_exception_mapping<std::decay_t<F>>::value))
+inline OUTCOME_FORCEINLINE auto catching(F &&f, Args &&...args) noexcept -> detail::catching_result_t<Result, F, Args...>
+{
+  return catching<Result>(exception_mapping<>(), static_cast<F &&>(f), static_cast<Args &&>(args)...);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,517 @@
+/* A lock free circuit breaker for result returning callables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_CIRCUIT_BREAKER_HPP
+#define OUTCOME_CIRCUIT_BREAKER_HPP
+
+#include "coroutine_support.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#ifndef OUTCOME_CIRCUIT_BREAKER_DOMAINS
+#define OUTCOME_CIRCUIT_BREAKER_DOMAINS 8
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+enum class circuit_breaker_errc
+{
+  circuit_open = 1
+};
+
+namespace detail
+{
+  class circuit_breaker_category_impl : public std::error_category
+  {
+  public:
+    const char *name() const noexcept override { return "outcome circuit breaker"; }
+    std::string message(int c) const override { return (c == static_cast<int>(circuit_breaker_errc::circuit_open)) ? "circuit open" : "unknown"; }
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline const std::error_category &circuit_breaker_category() noexcept
+{
+  static const detail::circuit_breaker_category_impl v;
+  return v;
+}
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline std::error_code make_error_code(circuit_breaker_errc c) noexcept
+{
+  return {static_cast<int>(c), circuit_breaker_category()};
+}
+
+namespace trait
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class EC> struct circuit_open_error
+  {
+    static constexpr bool value = false;
+  };
+  template <> struct circuit_open_error<std::error_code>
+  {
+    static constexpr bool value = true;
+    static std::error_code make() noexcept { return make_error_code(circuit_breaker_errc::circuit_open); }
+  };
+}  // namespace trait
+
+namespace detail
+{
+  // Identifies the category or domain of an error, so failures of each can be told apart
+  struct circuit_breaker_domain_id
+  {
+    uint64_t key;
+    const char *name;
+  };
+  template <class E>
+  inline auto circuit_breaker_domain_of(const E &e, int /*unused*/) -> decltype(e.category().name(), circuit_breaker_domain_id())
+  {
+    return {static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&e.category())), e.category().name()};
+  }
+  template <class E>
+  inline auto circuit_breaker_domain_of(const E &e, long /*unused*/) -> decltype(static_cast<uint64_t>(e.domain().id()), circuit_breaker_domain_id())
+  {
+    // Status code domain names need not outlive the string_ref returned, so none is kept
+    return {static_cast<uint64_t>(e.domain().id()), nullptr};
+  }
+  template <class E> inline circuit_breaker_domain_id circuit_breaker_domain_of(const E & /*unused*/, ...) { return {1, nullptr}; }
+
+  struct circuit_breaker_any_error
+  {
+    template <class E> constexpr bool operator()(const E & /*unused*/) const noexcept { return true; }
+  };
+
+  template <class A> using circuit_breaker_awaitable_result = std::decay_t<decltype(std::declval<A &>().await_resume())>;
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+class circuit_breaker
+{
+public:
+  using clock_type = std::chrono::steady_clock;
+  using duration = typename clock_type::duration;
+
+  enum class state_type
+  {
+    closed,
+    open,
+    half_open
+  };
+
+  struct config
+  {
+    duration window{std::chrono::seconds(10)};  // over which failure ratios are calculated
+    uint32_t buckets{10};                       // into which the window is divided
+    uint32_t minimum_calls{20};                 // in the window before the circuit can open
+    double failure_ratio{0.5};                  // of the calls in the window failing in one domain which opens the circuit
+    duration open_duration{std::chrono::seconds(5)};
+    uint32_t half_open_probes{1};  // calls let through concurrently to probe whether to close again
+  };
+
+  struct domain_statistics
+  {
+    uint64_t key{0};            // zero if unused
+    const char *name{nullptr};  // of the error category, if it has one
+    uint64_t failures{0};       // since construction
+    uint64_t window_failures{0};
+  };
+
+  struct statistics
+  {
+    state_type state{state_type::closed};
+    uint64_t calls{0};      // admitted
+    uint64_t successes{0};  // including failures not counted as such
+    uint64_t failures{0};
+    uint64_t rejected{0};  // calls short circuited whilst open
+    uint64_t opened{0};    // times the circuit has opened
+    uint64_t window_calls{0};
+    domain_statistics domains[OUTCOME_CIRCUIT_BREAKER_DOMAINS + 1];  // the last is all those which did not fit
+  };
+
+private:
+  static constexpr int64_t _closed = INT64_MIN;
+  static constexpr size_t _domain_count = OUTCOME_CIRCUIT_BREAKER_DOMAINS + 1;
+
+  struct _bucket
+  {
+    std::atomic<int64_t> epoch{-1};
+    std::atomic<uint32_t> calls{0};
+    std::atomic<uint32_t> failures[_domain_count];
+
+    _bucket() noexcept
+    {
+      for(auto &i : failures)
+      {
+        i.store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+  struct _domain
+  {
+    std::atomic<uint64_t> key{0};
+    std::atomic<const char *> name{nullptr};
+    std::atomic<uint64_t> failures{0};
+  };
+  enum class _admission
+  {
+    rejected,
+    admitted,
+    probe
+  };
+
+  config _config;
+  int64_t _bucket_ticks;
+  std::unique_ptr<_bucket[]> _buckets;
+  _domain _domains[_domain_count];
+  std::atomic<int64_t> _opened_at{_closed}, _reset_epoch{0};
+  std::atomic<uint32_t> _probes{0};
+  std::atomic<uint64_t> _calls{0}, _successes{0}, _failures{0}, _rejected{0}, _opened{0};
+
+  static int64_t _now() noexcept { return clock_type::now().time_since_epoch().count(); }
+
+  _bucket &_bucket_for(int64_t epoch) noexcept
+  {
+    _bucket &b = _buckets[static_cast<size_t>(epoch) % _config.buckets];
+    int64_t e = b.epoch.load(std::memory_order_acquire);
+    // Whoever moves the bucket on to this epoch empties it, and counts racing with that may be lost
+    if(e < epoch && b.epoch.compare_exchange_strong(e, epoch, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+      b.calls.store(0, std::memory_order_relaxed);
+      for(auto &i : b.failures)
+      {
+        i.store(0, std::memory_order_relaxed);
+      }
+    }
+    return b;
+  }
+  size_t _domain_index(const detail::circuit_breaker_domain_id &id) noexcept
+  {
+    const uint64_t key = (id.key == 0) ? 1 : id.key;
+    for(size_t n = 0; n < _domain_count - 1; n++)
+    {
+      uint64_t expected = _domains[n].key.load(std::memory_order_acquire);
+      if(expected == 0)
+      {
+        if(_domains[n].key.compare_exchange_strong(expected, key, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          _domains[n].name.store(id.name, std::memory_order_release);
+          return n;
+        }
+      }
+      if(expected == key)
+      {
+        return n;
+      }
+    }
+    return _domain_count - 1;
+  }
+  // Sums the calls and the failures of the domain within the window
+  void _window(int64_t epoch, size_t domain, uint64_t &calls, uint64_t &failures) const noexcept
+  {
+    const int64_t oldest = epoch - static_cast<int64_t>(_config.buckets) + 1, reset = _reset_epoch.load(std::memory_order_acquire);
+    calls = failures = 0;
+    for(uint32_t n = 0; n < _config.buckets; n++)
+    {
+      const _bucket &b = _buckets[n];
+      const int64_t e = b.epoch.load(std::memory_order_acquire);
+      if(e >= oldest && e >= reset && e <= epoch)
+      {
+        calls += b.calls.load(std::memory_order_relaxed);
+        if(domain < _domain_count)
+        {
+          failures += b.failures[domain].load(std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+  // Forgets the calls in the window so far
+  void _forget(int64_t epoch) noexcept
+  {
+    _reset_epoch.store(epoch, std::memory_order_release);
+    _bucket &b = _bucket_for(epoch);
+    b.calls.store(0, std::memory_order_relaxed);
+    for(auto &i : b.failures)
+    {
+      i.store(0, std::memory_order_relaxed);
+    }
+  }
+  _admission _admit() noexcept
+  {
+    const int64_t opened_at = _opened_at.load(std::memory_order_acquire);
+    if(opened_at == _closed)
+    {
+      return _admission::admitted;
+    }
+    if(_now() - opened_at < _config.open_duration.count())
+    {
+      return _admission::rejected;
+    }
+    uint32_t probes = _probes.load(std::memory_order_relaxed);
+    do
+    {
+      if(probes >= _config.half_open_probes)
+      {
+        return _admission::rejected;
+      }
+    } while(!_probes.compare_exchange_weak(probes, probes + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+    return _admission::probe;
+  }
+  // domain is _domain_count for a success
+  void _record(_admission a, size_t domain) noexcept
+  {
+    const int64_t now = _now(), epoch = now / _bucket_ticks;
+    _bucket &b = _bucket_for(epoch);
+    b.calls.fetch_add(1, std::memory_order_relaxed);
+    if(domain == _domain_count)
+    {
+      _successes.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      _failures.fetch_add(1, std::memory_order_relaxed);
+      _domains[domain].failures.fetch_add(1, std::memory_order_relaxed);
+      b.failures[domain].fetch_add(1, std::memory_order_relaxed);
+    }
+    if(a == _admission::probe)
+    {
+      if(domain == _domain_count)
+      {
+        // Close, forgetting the failures which opened the circuit
+        _forget(epoch);
+        _opened_at.store(_closed, std::memory_order_release);
+      }
+      else
+      {
+        _opened_at.store(now, std::memory_order_release);
+        _opened.fetch_add(1, std::memory_order_relaxed);
+      }
+      _probes.fetch_sub(1, std::memory_order_acq_rel);
+      return;
+    }
+    if(domain != _domain_count)
+    {
+      uint64_t calls, failures;
+      _window(epoch, domain, calls, failures);
+      if(calls >= _config.minimum_calls && static_cast<double>(failures) >= _config.failure_ratio * static_cast<double>(calls))
+      {
+        int64_t expected = _closed;
+        if(_opened_at.compare_exchange_strong(expected, now, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          _opened.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+  template <class R, class Classifier> void _record_result(_admission a, const R &r, Classifier &is_failure) noexcept
+  {
+    if(r.has_value())
+    {
+      _record(a, _domain_count);
+    }
+    else if(!r.has_error())
+    {
+      _record(a, _domain_count - 1);
+    }
+    else if(!is_failure(r.assume_error()))
+    {
+      _record(a, _domain_count);
+    }
+    else
+    {
+      _record(a, _domain_index(detail::circuit_breaker_domain_of(r.assume_error(), 0)));
+    }
+  }
+  template <class R> static R _open_error()
+  {
+    using error_type = typename R::error_type;
+    static_assert(trait::circuit_open_error<error_type>::value, "trait::circuit_open_error<EC> must be specialised to say what error to return whilst open");
+    return R(in_place_type<error_type>, trait::circuit_open_error<error_type>::make());
+  }
+
+public:
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  circuit_breaker()
+      : circuit_breaker(config())
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  explicit circuit_breaker(config c)
+      : _config(c)
+  {
+    if(_config.buckets == 0)
+    {
+      _config.buckets = 1;
+    }
+    _bucket_ticks = _config.window.count() / _config.buckets;
+    if(_bucket_ticks <= 0)
+    {
+      _bucket_ticks = 1;
+    }
+    _buckets.reset(new _bucket[_config.buckets]);
+  }
+  circuit_breaker(const circuit_breaker &) = delete;
+  circuit_breaker(circuit_breaker &&) = delete;
+  circuit_breaker &operator=(const circuit_breaker &) = delete;
+  circuit_breaker &operator=(circuit_breaker &&) = delete;
+  ~circuit_breaker() = default;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class F, class Classifier = detail::circuit_breaker_any_error> auto call(F &&f, Classifier is_failure = {}) -> decltype(f())
+  {
+    using result_type = decltype(f());
+    const _admission a = _admit();
+    if(a == _admission::rejected)
+    {
+      _rejected.fetch_add(1, std::memory_order_relaxed);
+      return _open_error<result_type>();
+    }
+    _calls.fetch_add(1, std::memory_order_relaxed);
+#ifdef __cpp_exceptions
+    try
+#endif
+    {
+      result_type r = f();
+      _record_result(a, r, is_failure);
+      return r;
+    }
+#ifdef __cpp_exceptions
+    catch(...)
+    {
+      _record(a, _domain_count - 1);
+      throw;
+    }
+#endif
+  }
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class F, class Classifier = detail::circuit_breaker_any_error>
+  awaitables::lazy<detail::circuit_breaker_awaitable_result<decltype(std::declval<F &>()())>> co_call(F f, Classifier is_failure = {})
+  {
+    using result_type = detail::circuit_breaker_awaitable_result<decltype(std::declval<F &>()())>;
+    const _admission a = _admit();
+    if(a == _admission::rejected)
+    {
+      _rejected.fetch_add(1, std::memory_order_relaxed);
+      co_return _open_error<result_type>();
+    }
+    _calls.fetch_add(1, std::memory_order_relaxed);
+#ifdef __cpp_exceptions
+    try
+#endif
+    {
+      result_type r = co_await f();
+      _record_result(a, r, is_failure);
+      co_return r;
+    }
+#ifdef __cpp_exceptions
+    catch(...)
+    {
+      _record(a, _domain_count - 1);
+      throw;
+    }
+#endif
+  }
+#endif
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  state_type state() const noexcept
+  {
+    const int64_t opened_at = _opened_at.load(std::memory_order_acquire);
+    if(opened_at == _closed)
+    {
+      return state_type::closed;
+    }
+    return (_now() - opened_at < _config.open_duration.count()) ? state_type::open : state_type::half_open;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  void reset() noexcept
+  {
+    _forget(_now() / _bucket_ticks);
+    _opened_at.store(_closed, std::memory_order_release);
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  statistics stats() const noexcept
+  {
+    statistics ret;
+    const int64_t epoch = _now() / _bucket_ticks;
+    ret.state = state();
+    ret.calls = _calls.load(std::memory_order_relaxed);
+    ret.successes = _successes.load(std::memory_order_relaxed);
+    ret.failures = _failures.load(std::memory_order_relaxed);
+    ret.rejected = _rejected.load(std::memory_order_relaxed);
+    ret.opened = _opened.load(std::memory_order_relaxed);
+    for(size_t n = 0; n < _domain_count; n++)
+    {
+      ret.domains[n].key = _domains[n].key.load(std::memory_order_acquire);
+      ret.domains[n].name = _domains[n].name.load(std::memory_order_acquire);
+      ret.domains[n].failures = _domains[n].failures.load(std::memory_order_relaxed);
+      _window(epoch, n, ret.window_calls, ret.domains[n].window_failures);
+    }
+    return ret;
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+namespace std
+{
+  template <> struct is_error_code_enum<OUTCOME_V2_NAMESPACE::circuit_breaker_errc> : std::true_type
+  {
+  };
+}  // namespace std
+
+#endif
@@ -49,6 +49,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #ifdef DOXYGEN_IS_IN_THE_HOUSE
 #define OUTCOME_FORCEINLINE
+#define OUTCOME_NOINLINE
 #define OUTCOME_NODISCARD [[nodiscard]]
 #define OUTCOME_TEMPLATE(...) template <__VA_ARGS__
 #define OUTCOME_TREQUIRES(...) , __VA_ARGS__ >
@@ -66,6 +67,9 @@ SIGNATURE NOT RECOGNISED
 #ifndef OUTCOME_FORCEINLINE
 #define OUTCOME_FORCEINLINE QUICKCPPLIB_FORCEINLINE
 #endif
+#ifndef OUTCOME_NOINLINE
+#define OUTCOME_NOINLINE QUICKCPPLIB_NOINLINE
+#endif
 #ifndef OUTCOME_NODISCARD
 #define OUTCOME_NODISCARD QUICKCPPLIB_NODISCARD
 #endif
@@ -94,27 +98,53 @@ SIGNATURE NOT RECOGNISED
 #define OUTCOME_ENABLE_LEGACY_SUPPORT_FOR 220  // the v2.2 Outcome release
 #endif
 
+#ifndef OUTCOME_ENABLE_FAILURE_EXCEPTION_CACHE
+#define OUTCOME_ENABLE_FAILURE_EXCEPTION_CACHE 0
+#endif
+
+#ifndef OUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE
+// Changes the layout of basic_outcome, so it also changes the ABI namespace
+#define OUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE 0
+#endif
+
 #include "detail/revision.hpp"
 #if defined(OUTCOME_UNSTABLE_VERSION)
 #define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2, OUTCOME_PREVIOUS_COMMIT_UNIQUE))
 #ifdef _DEBUG
 #define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2d, OUTCOME_PREVIOUS_COMMIT_UNIQUE)))
+#define OUTCOME_V2_CXX_EXPERIMENTAL_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2d_experimental, OUTCOME_PREVIOUS_COMMIT_UNIQUE)))
 #else
 #define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2, OUTCOME_PREVIOUS_COMMIT_UNIQUE)))
+#define OUTCOME_V2_CXX_EXPERIMENTAL_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2_experimental, OUTCOME_PREVIOUS_COMMIT_UNIQUE)))
 #endif
 #else
 #define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2))
 #ifdef _DEBUG
 #define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2d)))
+#define OUTCOME_V2_CXX_EXPERIMENTAL_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2d_experimental)))
 #else
 #define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2)))
+#define OUTCOME_V2_CXX_EXPERIMENTAL_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2_experimental)))
+#endif
+#endif
+#if OUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE
+#undef OUTCOME_V2
+#if defined(OUTCOME_UNSTABLE_VERSION)
+#define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2, overlapped, OUTCOME_PREVIOUS_COMMIT_UNIQUE))
+#else
+#define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2, overlapped))
 #endif
 #endif
 
+// The module interface units define this to `export` once past their module declaration,
+// so headers pulled into their global module fragment don't try to export anything
+#ifndef OUTCOME_V2_CXX_MODULE_EXPORT
+#define OUTCOME_V2_CXX_MODULE_EXPORT
+#endif
 #if defined(GENERATING_OUTCOME_MODULE_INTERFACE)
 #define OUTCOME_V2_NAMESPACE QUICKCPPLIB_BIND_NAMESPACE(OUTCOME_V2)
 #define OUTCOME_V2_NAMESPACE_BEGIN QUICKCPPLIB_BIND_NAMESPACE_BEGIN(OUTCOME_V2)
-#define OUTCOME_V2_NAMESPACE_EXPORT_BEGIN QUICKCPPLIB_BIND_NAMESPACE_EXPORT_BEGIN(OUTCOME_V2)
+#define OUTCOME_V2_NAMESPACE_EXPORT_BEGIN OUTCOME_V2_CXX_MODULE_EXPORT QUICKCPPLIB_BIND_NAMESPACE_BEGIN(OUTCOME_V2)
 #define OUTCOME_V2_NAMESPACE_END QUICKCPPLIB_BIND_NAMESPACE_END(OUTCOME_V2)
 #else
 #define OUTCOME_V2_NAMESPACE QUICKCPPLIB_BIND_NAMESPACE(OUTCOME_V2)
@@ -257,7 +287,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
+  template <class T, class U> constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
 
   template <class T, class U> struct _is_implicitly_constructible
   {
@@ -271,7 +301,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
+  template <class T, class U> constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
 
   template <class T, class... Args> struct _is_nothrow_constructible
   {
@@ -285,7 +315,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class... Args> static constexpr bool is_nothrow_constructible = _is_nothrow_constructible<T, Args...>::value;
+  template <class T, class... Args> constexpr bool is_nothrow_constructible = _is_nothrow_constructible<T, Args...>::value;
 
   template <class T, class... Args> struct _is_constructible
   {
@@ -299,7 +329,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class... Args> static constexpr bool is_constructible = _is_constructible<T, Args...>::value;
+  template <class T, class... Args> constexpr bool is_constructible = _is_constructible<T, Args...>::value;
 
 #ifndef OUTCOME_USE_STD_IS_NOTHROW_SWAPPABLE
 #if defined(_MSC_VER) && _HAS_CXX17
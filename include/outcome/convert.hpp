@@ -99,21 +99,21 @@ namespace concepts
     inline U match_value_or_error(U &&);
 
     template <class U>
-    static constexpr bool value_or_none =
+    constexpr bool value_or_none =
     !std::is_same<no_match, decltype(match_value_or_none(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
     template <class U>
-    static constexpr bool value_or_error =
+    constexpr bool value_or_error =
     !std::is_same<no_match, decltype(match_value_or_error(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
   }  // namespace detail
   /* The `value_or_none` concept.
   \requires That `U::value_type` exists and that `std::declval<U>().has_value()` returns a `bool` and `std::declval<U>().value()` exists.
   */
-  template <class U> static constexpr bool value_or_none = detail::value_or_none<U>;
+  template <class U> constexpr bool value_or_none = detail::value_or_none<U>;
   /* The `value_or_error` concept.
   \requires That `U::value_type` and `U::error_type` exist;
   that `std::declval<U>().has_value()` returns a `bool`, `std::declval<U>().value()` and  `std::declval<U>().error()` exists.
   */
-  template <class U> static constexpr bool value_or_error = detail::value_or_error<U>;
+  template <class U> constexpr bool value_or_error = detail::value_or_error<U>;
 #endif
 }  // namespace concepts
 
@@ -126,8 +126,8 @@ namespace convert
   template <class U>
   concept OUTCOME_GCC6_CONCEPT_BOOL ValueOrError = concepts::value_or_error<U>;
 #else
-  template <class U> static constexpr bool ValueOrNone = concepts::value_or_none<U>;
-  template <class U> static constexpr bool ValueOrError = concepts::value_or_error<U>;
+  template <class U> constexpr bool ValueOrNone = concepts::value_or_none<U>;
+  template <class U> constexpr bool ValueOrError = concepts::value_or_error<U>;
 #endif
 #endif
 
@@ -55,6 +55,22 @@ OUTCOME_V2_NAMESPACE_END
 
 #include "detail/coroutine_support.ipp"
 
+#include <system_error>
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace awaitables
+{
+  namespace detail
+  {
+    template <> struct cancellation_traits<std::error_code>
+    {
+      static constexpr bool value = true;
+      static std::error_code make() noexcept { return std::make_error_code(std::errc::operation_canceled); }
+    };
+  }  // namespace detail
+}  // namespace awaitables
+OUTCOME_V2_NAMESPACE_END
+
 #undef OUTCOME_COROUTINE_SUPPORT_NAMESPACE_BEGIN
 #undef OUTCOME_COROUTINE_SUPPORT_NAMESPACE_EXPORT_BEGIN
 #undef OUTCOME_COROUTINE_SUPPORT_NAMESPACE_END
@@ -0,0 +1,310 @@
+/* Storage of the exception for outcome type
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_BASIC_OUTCOME_EXCEPTION_STORAGE_HPP
+#define OUTCOME_BASIC_OUTCOME_EXCEPTION_STORAGE_HPP
+
+#include "basic_result_storage.hpp"
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  /* Whether basic_outcome keeps its exception inside the storage of its value, which it
+  never has at the same time. Only done if the value and the error are stored separately,
+  as otherwise error + exception would stop being representable, and only if the exception
+  fits and can always be moved out of the way without throwing.
+  */
+  template <class R, class S, class P>
+  constexpr bool outcome_exception_overlaps_value =                  //
+  OUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE                        //
+  && !std::is_void<R>::value && !std::is_void<P>::value              //
+  && !std::is_same<R, S>::value && !std::is_same<R, P>::value        //
+  && !(is_storage_trivial<R>::value && is_storage_trivial<S>::value)  //
+  && sizeof(devoid<R>) >= sizeof(devoid<P>) && alignof(devoid<R>) >= alignof(devoid<P>)
+  && std::is_nothrow_move_constructible<devoid<P>>::value && std::is_nothrow_move_assignable<devoid<P>>::value
+  && (std::is_nothrow_copy_constructible<devoid<P>>::value || !std::is_copy_constructible<devoid<P>>::value);
+
+  // Constructs the exception, and default constructs everything else
+  struct exception_construction_tag
+  {
+  };
+  // Constructs everything else from the trailing args, and the exception from the first if present
+  struct failure_construction_tag
+  {
+  };
+
+  // The exception as a member following the value and error, the default
+  template <class Base, class R, class S, class P> class basic_outcome_separate_exception_storage : public Base
+  {
+    template <class T, class U, class V, class W> friend class basic_outcome;
+
+  protected:
+    using _exception_type_ = devoid<P>;
+
+    _exception_type_ _ptr_storage{};
+
+    constexpr _exception_type_ &_ptr() & noexcept { return _ptr_storage; }
+    constexpr const _exception_type_ &_ptr() const & noexcept { return _ptr_storage; }
+    constexpr _exception_type_ &&_ptr() && noexcept { return static_cast<_exception_type_ &&>(_ptr_storage); }
+    constexpr const _exception_type_ &&_ptr() const && noexcept { return static_cast<const _exception_type_ &&>(_ptr_storage); }
+
+    template <class U> constexpr void _set_ptr(U &&v) { _ptr_storage = static_cast<U &&>(v); }
+
+    // basic_outcome::swap() swaps the exception itself
+    constexpr bool _swap_overlapped(basic_outcome_separate_exception_storage & /*unused*/) noexcept { return false; }
+
+  public:
+    using Base::Base;
+
+    template <class... Args>
+    constexpr explicit basic_outcome_separate_exception_storage(exception_construction_tag /*unused*/,
+                                                                Args &&...args) noexcept(detail::is_nothrow_constructible<_exception_type_, Args...>)
+        : Base()
+        , _ptr_storage(static_cast<Args &&>(args)...)
+    {
+    }
+    template <class T, class... Args>
+    constexpr basic_outcome_separate_exception_storage(failure_construction_tag /*unused*/, bool have_exception, T &&e, Args &&...args)
+        : Base(static_cast<Args &&>(args)...)
+        , _ptr_storage(have_exception ? _exception_type_(static_cast<T &&>(e)) : _exception_type_())
+    {
+    }
+  };
+
+  // The exception within the storage of the value, opted into with OUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE
+  template <class Base, class R, class S, class P> class basic_outcome_overlapped_exception_storage : public Base
+  {
+    template <class T, class U, class V, class W> friend class basic_outcome;
+
+  protected:
+    using _exception_type_ = P;
+
+    // The exception is only present if there is no value to share its storage with
+    bool _have_ptr() const noexcept { return this->_state._status.have_exception() && !this->_state._status.have_value(); }
+    P *_ptr_address() noexcept { return reinterpret_cast<P *>(OUTCOME_ADDRESS_OF(this->_state._value)); }  // NOLINT
+    const P *_ptr_address() const noexcept { return reinterpret_cast<const P *>(OUTCOME_ADDRESS_OF(this->_state._value)); }  // NOLINT
+
+    P &_ptr() & noexcept { return *_ptr_address(); }
+    const P &_ptr() const & noexcept { return *_ptr_address(); }
+    P &&_ptr() && noexcept { return static_cast<P &&>(*_ptr_address()); }
+    const P &&_ptr() const && noexcept { return static_cast<const P &&>(*_ptr_address()); }
+
+    template <class U> void _set_ptr(U &&v)
+    {
+      if(_have_ptr())
+      {
+        _ptr() = static_cast<U &&>(v);
+        return;
+      }
+      if(this->_state._status.have_value())
+      {
+        // The exception displaces the value
+        using _value_type_ = typename Base::_state_type::_value_type_;
+        if(!trait::is_move_bitcopying<R>::value || !this->_state._status.have_moved_from())
+        {
+          this->_state._value.~_value_type_();  // NOLINT
+        }
+        this->_state._status.set_have_value(false);
+      }
+      new(_ptr_address()) P(static_cast<U &&>(v));  // NOLINT
+    }
+
+    // Moves both exceptions out of the way of the swap of the values and errors, then puts them back
+    bool _swap_overlapped(basic_outcome_overlapped_exception_storage &o) noexcept(noexcept(this->_state.swap(o._state)))
+    {
+      struct some_type
+      {
+        basic_outcome_overlapped_exception_storage &a, &b;
+        P a_ptr{}, b_ptr{};
+        bool a_had{false}, b_had{false}, all_good{false};
+        static void take(basic_outcome_overlapped_exception_storage &x, P &to, bool &had) noexcept
+        {
+          had = x._have_ptr();
+          if(had)
+          {
+            to = static_cast<P &&>(x._ptr());
+            x._ptr().~P();
+            x._state._status.set_have_exception(false);
+          }
+        }
+        static void give(basic_outcome_overlapped_exception_storage &x, P &from, bool have) noexcept
+        {
+          if(have)
+          {
+            if(x._state._status.have_value())
+            {
+              // Can only happen if the swap threw and took the value with it
+              x._state._status.set_have_lost_consistency(true);
+              return;
+            }
+            new(x._ptr_address()) P(static_cast<P &&>(from));  // NOLINT
+            x._state._status.set_have_exception(true);
+          }
+        }
+        ~some_type()
+        {
+          if(this->all_good)
+          {
+            give(this->a, this->b_ptr, this->b_had);
+            give(this->b, this->a_ptr, this->a_had);
+          }
+          else
+          {
+            give(this->a, this->a_ptr, this->a_had);
+            give(this->b, this->b_ptr, this->b_had);
+          }
+        }
+      } some_type_value{*this, o};
+      some_type::take(*this, some_type_value.a_ptr, some_type_value.a_had);
+      some_type::take(o, some_type_value.b_ptr, some_type_value.b_had);
+      this->_state.swap(o._state);
+      some_type_value.all_good = true;
+      return true;
+    }
+
+  public:
+    using Base::Base;
+
+    basic_outcome_overlapped_exception_storage() = default;
+    basic_outcome_overlapped_exception_storage(const basic_outcome_overlapped_exception_storage &o) noexcept(
+    std::is_nothrow_copy_constructible<Base>::value &&std::is_nothrow_copy_constructible<P>::value)
+        : Base(o)
+    {
+      if(o._have_ptr())
+      {
+        new(_ptr_address()) P(o._ptr());  // NOLINT
+      }
+    }
+    basic_outcome_overlapped_exception_storage(basic_outcome_overlapped_exception_storage &&o) noexcept(std::is_nothrow_move_constructible<Base>::value)
+        : Base(static_cast<Base &&>(o))
+    {
+      if(o._have_ptr())
+      {
+        new(_ptr_address()) P(static_cast<P &&>(o._ptr()));  // NOLINT
+      }
+    }
+    basic_outcome_overlapped_exception_storage &operator=(const basic_outcome_overlapped_exception_storage &o) noexcept(
+    std::is_nothrow_copy_assignable<Base>::value &&std::is_nothrow_copy_assignable<P>::value)
+    {
+      const bool had = _have_ptr();
+      if(had && !o._have_ptr())
+      {
+        _ptr().~P();
+        this->_state._status.set_have_exception(false);
+      }
+      Base::operator=(o);
+      if(o._have_ptr())
+      {
+        if(had)
+        {
+          _ptr() = o._ptr();
+        }
+        else
+        {
+          new(_ptr_address()) P(o._ptr());  // NOLINT
+        }
+      }
+      return *this;
+    }
+    basic_outcome_overlapped_exception_storage &operator=(basic_outcome_overlapped_exception_storage &&o) noexcept(std::is_nothrow_move_assignable<Base>::value)
+    {
+      const bool had = _have_ptr();
+      if(had && !o._have_ptr())
+      {
+        _ptr().~P();
+        this->_state._status.set_have_exception(false);
+      }
+      const bool o_had = o._have_ptr();
+      Base::operator=(static_cast<Base &&>(o));
+      if(o_had)
+      {
+        if(had)
+        {
+          _ptr() = static_cast<P &&>(o._ptr());
+        }
+        else
+        {
+          new(_ptr_address()) P(static_cast<P &&>(o._ptr()));  // NOLINT
+        }
+      }
+      return *this;
+    }
+    ~basic_outcome_overlapped_exception_storage()
+    {
+      if(_have_ptr())
+      {
+        _ptr().~P();
+        // Already false, but the compiler can't see that after the exception's destructor, and
+        // would warn that the value is destroyed uninitialised by the base destructor
+        this->_state._status.set_have_value(false);
+      }
+    }
+
+    template <class... Args>
+    explicit basic_outcome_overlapped_exception_storage(exception_construction_tag /*unused*/,
+                                                        Args &&...args) noexcept(detail::is_nothrow_constructible<P, Args...>)
+        : Base()
+    {
+      new(_ptr_address()) P(static_cast<Args &&>(args)...);  // NOLINT
+    }
+    template <class T, class... Args>
+    basic_outcome_overlapped_exception_storage(failure_construction_tag /*unused*/, bool have_exception, T &&e, Args &&...args)
+        : Base(static_cast<Args &&>(args)...)
+    {
+      if(have_exception && !this->_state._status.have_value())
+      {
+        new(_ptr_address()) P(static_cast<T &&>(e));  // NOLINT
+      }
+    }
+  };
+
+  // The copy and move operations of the overlapped storage exist only if the value and error's do
+  template <class Base, class R, class S, class P, class Impl = basic_outcome_overlapped_exception_storage<Base, R, S, P>>
+  using select_overlapped_exception_storage_move_constructor =
+  std::conditional_t<std::is_move_constructible<devoid<R>>::value && std::is_move_constructible<devoid<S>>::value, Impl,
+                     value_storage_delete_move_constructor<Impl>>;
+  template <class Base, class R, class S, class P, class Impl = select_overlapped_exception_storage_move_constructor<Base, R, S, P>>
+  using select_overlapped_exception_storage_copy_constructor =
+  std::conditional_t<std::is_copy_constructible<devoid<R>>::value && std::is_copy_constructible<devoid<S>>::value &&
+                     std::is_copy_constructible<P>::value,
+                     Impl, value_storage_delete_copy_constructor<Impl>>;
+  template <class Base, class R, class S, class P, class Impl = select_overlapped_exception_storage_copy_constructor<Base, R, S, P>>
+  using select_overlapped_exception_storage_move_assignment =
+  std::conditional_t<is_move_assignable<devoid<R>>::value && is_move_assignable<devoid<S>>::value, Impl, value_storage_delete_move_assignment<Impl>>;
+  template <class Base, class R, class S, class P, class Impl = select_overlapped_exception_storage_move_assignment<Base, R, S, P>>
+  using select_overlapped_exception_storage_copy_assignment =
+  std::conditional_t<is_copy_assignable<devoid<R>>::value && is_copy_assignable<devoid<S>>::value && std::is_copy_constructible<P>::value &&
+                     std::is_copy_assignable<P>::value,
+                     Impl, value_storage_delete_copy_assignment<Impl>>;
+
+  template <class Base, class R, class S, class P>
+  using select_basic_outcome_exception_storage =
+  std::conditional_t<outcome_exception_overlaps_value<R, S, P>, select_overlapped_exception_storage_copy_assignment<Base, R, S, P>,
+                     basic_outcome_separate_exception_storage<Base, R, S, P>>;
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -53,6 +53,10 @@ namespace detail
     constexpr bool has_exception() const noexcept { return this->_state._status.have_exception(); }
     constexpr bool has_lost_consistency() const noexcept { return this->_state._status.have_lost_consistency(); }
     constexpr bool has_failure() const noexcept { return this->_state._status.have_error() || this->_state._status.have_exception(); }
+    constexpr bool error_is_errno(int errcode) const noexcept
+    {
+      return this->_state._status.have_error() && this->_state._status.have_error_is_errno() && _errno_value(this->_state, this->_state._error) == errcode;
+    }
 
     OUTCOME_TEMPLATE(class T, class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<detail::devoid<R>>() == std::declval<detail::devoid<T>>()),  //
@@ -66,7 +70,7 @@ namespace detail
       }
       if(this->_state._status.have_error() && o._state._status.have_error())
       {
-        return this->_state._error == o._state._error;
+        return _error_compare<true>(this->_state._error, this->_state._status, o._state._error, o._state._status);
       }
       return false;
     }
@@ -93,7 +97,7 @@ namespace detail
     {
       if(this->_state._status.have_error())
       {
-        return this->_state._error == o.error();
+        return _error_compare<true>(this->_state._error, this->_state._status, o.error(), status_bitfield_type(status::have_error));
       }
       return false;
     }
@@ -109,7 +113,7 @@ namespace detail
       }
       if(this->_state._status.have_error() && o._state._status.have_error())
       {
-        return this->_state._error != o._state._error;
+        return _error_compare<false>(this->_state._error, this->_state._status, o._state._error, o._state._status);
       }
       return true;
     }
@@ -136,7 +140,7 @@ namespace detail
     {
       if(this->_state._status.have_error())
       {
-        return this->_state._error != o.error();
+        return _error_compare<false>(this->_state._error, this->_state._status, o.error(), status_bitfield_type(status::have_error));
       }
       return true;
     }
@@ -29,8 +29,10 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_DETAIL_COROUTINE_SUPPORT_HPP
 #define OUTCOME_DETAIL_COROUTINE_SUPPORT_HPP
 
+#include <array>
 #include <atomic>
 #include <exception>
+#include <tuple>
 
 #ifndef OUTCOME_COROUTINE_HEADER_TYPE
 #if __has_include(<coroutine>)
@@ -59,7 +61,7 @@ Distributed under the Boost Software License, Version 1.0.
 #endif
 #if OUTCOME_COROUTINE_HEADER_TYPE == 1
 #include <coroutine>
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 namespace awaitables
 {
   template <class Promise = void> using coroutine_handle = std::coroutine_handle<Promise>;
@@ -74,7 +76,7 @@ OUTCOME_V2_NAMESPACE_END
 #define OUTCOME_FOUND_COROUTINE_HEADER 1
 #elif OUTCOME_COROUTINE_HEADER_TYPE == 2
 #include <experimental/coroutine>
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 namespace awaitables
 {
   template <class Promise = void> using coroutine_handle = std::experimental::coroutine_handle<Promise>;
@@ -90,6 +92,17 @@ OUTCOME_V2_NAMESPACE_END
 #endif
 #endif
 
+#ifndef OUTCOME_CORO_AWAIT_ELIDABLE
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::coro_await_elidable)
+#define OUTCOME_CORO_AWAIT_ELIDABLE [[clang::coro_await_elidable]]
+#endif
+#endif
+#endif
+#ifndef OUTCOME_CORO_AWAIT_ELIDABLE
+#define OUTCOME_CORO_AWAIT_ELIDABLE
+#endif
+
 #ifndef OUTCOME_V2_AWAITABLES_DEBUG_PRINTER
 // #include <iostream>
 // #define OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(...) std::cout << __VA_ARGS__ << std::endl;
@@ -149,6 +162,16 @@ namespace awaitables
     {
       rethrow_exception(e);
     }
+    OUTCOME_TEMPLATE(class T)
+    OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<const T &>().has_failure()))
+    constexpr inline bool is_failed_item(const T &v, int /*unused*/) noexcept
+    {
+      return v.has_failure();
+    }
+    template <class T> constexpr inline bool is_failed_item(const T & /*unused*/, ...) noexcept
+    {
+      return false;
+    }
     template <class T> class fake_atomic
     {
       T _v;
@@ -169,10 +192,143 @@ namespace awaitables
         }
         return false;
       }
+      T exchange(T v, std::memory_order /*unused*/)
+      {
+        T ret = _v;
+        _v = v;
+        return ret;
+      }
+      T fetch_sub(T v, std::memory_order /*unused*/)
+      {
+        T ret = _v;
+        _v -= v;
+        return ret;
+      }
+    };
+
+    // Specialised by the including header for each error type which can represent cancellation
+    template <class E> struct cancellation_traits
+    {
+      static constexpr bool value = false;
+    };
+    template <class Cont, class E = typename decltype(extract_error_type<Cont>(5))::type, bool = cancellation_traits<E>::value> struct is_cancellable
+    {
+      static constexpr bool value = false;
+    };
+    template <class Cont, class E> struct is_cancellable<Cont, E, true>
+    {
+      static constexpr bool value = std::is_constructible<Cont, decltype(cancellation_traits<E>::make())>::value;
+    };
+
+    // A stop request may come from this stop state, or any of its parents
+    struct stop_state
+    {
+      std::atomic<bool> requested{false};
+      const stop_state *parent{nullptr};
+
+      bool stop_requested() const noexcept
+      {
+        for(auto *s = this; s != nullptr; s = s->parent)
+        {
+          if(s->requested.load(std::memory_order_acquire))
+          {
+            return true;
+          }
+        }
+        return false;
+      }
+      void request_stop() noexcept { requested.store(true, std::memory_order_release); }
+    };
+    template <class Promise> constexpr inline auto stop_state_of(Promise &p, int /*unused*/) noexcept -> decltype(static_cast<const stop_state *>(p.stop))
+    {
+      return p.stop;
+    }
+    template <class Promise> constexpr inline const stop_state *stop_state_of(Promise & /*unused*/, ...) noexcept { return nullptr; }
+
+    class stop_token
+    {
+      const stop_state *_s{nullptr};
+
+    public:
+      constexpr stop_token() noexcept {}
+      constexpr explicit stop_token(const stop_state *s) noexcept
+          : _s(s)
+      {
+      }
+      bool stop_possible() const noexcept { return _s != nullptr; }
+      bool stop_requested() const noexcept { return _s != nullptr && _s->stop_requested(); }
     };
 
 #ifdef OUTCOME_FOUND_COROUTINE_HEADER
-    template <class Awaitable, bool suspend_initial, bool use_atomic, bool is_void> struct outcome_promise_type
+    // Never suspends, just fetches the stop token of the awaiting coroutine
+    struct get_stop_token_awaiter
+    {
+      stop_token _t;
+
+      bool await_ready() noexcept { return false; }
+      template <class Promise> bool await_suspend(coroutine_handle<Promise> self) noexcept
+      {
+        _t = stop_token(detail::stop_state_of(self.promise(), 0));
+        return false;
+      }
+      stop_token await_resume() noexcept { return _t; }
+    };
+    inline get_stop_token_awaiter get_stop_token() noexcept { return {}; }
+
+    // Fetches the awaiter for a co_await operand, as the compiler would
+    template <class T> constexpr inline auto get_awaiter(T &&v, int /*unused*/, int /*unused*/) -> decltype(static_cast<T &&>(v).operator co_await())
+    {
+      return static_cast<T &&>(v).operator co_await();
+    }
+    template <class T> constexpr inline auto get_awaiter(T &&v, int /*unused*/, ...) -> decltype(operator co_await(static_cast<T &&>(v)))
+    {
+      return operator co_await(static_cast<T &&>(v));
+    }
+    template <class T> constexpr inline T &&get_awaiter(T &&v, ...) { return static_cast<T &&>(v); }
+
+    // Forwards to an awaiter, noting if it ever suspends the awaiting coroutine
+    template <class Awaiter> struct suspension_tracking_awaiter
+    {
+      Awaiter _a;
+      bool *_suspended;
+
+      decltype(auto) await_ready() { return _a.await_ready(); }
+      template <class Promise> decltype(auto) await_suspend(coroutine_handle<Promise> h)
+      {
+        *_suspended = true;
+        return _a.await_suspend(h);
+      }
+      decltype(auto) await_resume() { return _a.await_resume(); }
+    };
+
+    /* Atomic awaitables note whether their coroutine ever suspended. If it never did, it
+    completed upon the thread which started it, so no other thread can be concurrently awaiting
+    it, and the completion handoff to the awaiter need not be synchronised.
+    */
+    template <bool use_atomic> struct suspension_tracker
+    {
+      static constexpr bool may_have_suspended = true;
+    };
+    template <> struct suspension_tracker<true>
+    {
+      bool may_have_suspended{false};
+
+      // Returned by value, as some compilers copy awaiters returned by reference
+      template <class T> auto await_transform(T &&v)
+      {
+        using awaiter_type = decltype(detail::get_awaiter(static_cast<T &&>(v), 0, 0));
+        return suspension_tracking_awaiter<awaiter_type>{detail::get_awaiter(static_cast<T &&>(v), 0, 0), &may_have_suspended};
+      }
+    };
+    // Values of the completion handoff between an awaitable's coroutine and its awaiter
+    enum class handoff_state : int8_t
+    {
+      none,
+      awaiter_suspended,
+      completed
+    };
+
+    template <class Awaitable, bool suspend_initial, bool use_atomic, bool is_void> struct outcome_promise_type : suspension_tracker<use_atomic>
     {
       using container_type = typename Awaitable::container_type;
       using result_set_type = std::conditional_t<use_atomic, std::atomic<bool>, fake_atomic<bool>>;
@@ -181,8 +337,11 @@ namespace awaitables
         OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
         container_type result;
       };
+      using handoff_type = std::conditional_t<use_atomic, std::atomic<handoff_state>, fake_atomic<handoff_state>>;
       result_set_type result_set{false}, pending_first_resumption{is_initially_suspended};
+      handoff_type handoff{handoff_state::none};
       coroutine_handle<> continuation;
+      const stop_state *stop{nullptr};
 
       static constexpr bool is_initially_suspended = suspend_initial;
       static constexpr bool is_using_atomics = use_atomic;
@@ -248,6 +407,17 @@ namespace awaitables
 #endif
         result_set.store(true, std::memory_order_release);
       }
+      // The awaiter to resume upon completion, if there is one yet
+      coroutine_handle<> take_continuation() noexcept
+      {
+        if(!this->may_have_suspended)
+        {
+          // Any awaiter started us upon this thread before we ran
+          return continuation;
+        }
+        // Pairs with the exchange in the awaitable's await_suspend()
+        return (handoff.exchange(handoff_state::completed, std::memory_order_acq_rel) == handoff_state::awaiter_suspended) ? continuation : coroutine_handle<>();
+      }
       auto initial_suspend() noexcept
       {
         OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(this << " promise initial suspend = " << suspend_initial);
@@ -270,23 +440,25 @@ namespace awaitables
 #if OUTCOME_HAVE_NOOP_COROUTINE
           coroutine_handle<> await_suspend(coroutine_handle<outcome_promise_type> self) noexcept
           {
-            if(self.promise().continuation)
+            auto continuation = self.promise().take_continuation();
+            if(continuation)
             {
-              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << self.promise().continuation.address());
+              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << continuation.address());
             }
             else
             {
               OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will exit");
             }
-            return self.promise().continuation ? self.promise().continuation : noop_coroutine();
+            return continuation ? continuation : noop_coroutine();
           }
 #else
           void await_suspend(coroutine_handle<outcome_promise_type> self)
           {
-            if(self.promise().continuation)
+            auto continuation = self.promise().take_continuation();
+            if(continuation)
             {
-              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << self.promise().continuation.address());
-              return self.promise().continuation.resume();
+              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << continuation.address());
+              return continuation.resume();
             }
             else
             {
@@ -298,12 +470,16 @@ namespace awaitables
         return awaiter{};
       }
     };
-    template <class Awaitable, bool suspend_initial, bool use_atomic> struct outcome_promise_type<Awaitable, suspend_initial, use_atomic, true>
+    template <class Awaitable, bool suspend_initial, bool use_atomic>
+    struct outcome_promise_type<Awaitable, suspend_initial, use_atomic, true> : suspension_tracker<use_atomic>
     {
       using container_type = void;
       using result_set_type = std::conditional_t<use_atomic, std::atomic<bool>, fake_atomic<bool>>;
+      using handoff_type = std::conditional_t<use_atomic, std::atomic<handoff_state>, fake_atomic<handoff_state>>;
       result_set_type result_set{false}, pending_first_resumption{is_initially_suspended};
+      handoff_type handoff{handoff_state::none};
       coroutine_handle<> continuation;
+      const stop_state *stop{nullptr};
 
       static constexpr bool is_initially_suspended = suspend_initial;
       static constexpr bool is_using_atomics = use_atomic;
@@ -331,6 +507,17 @@ namespace awaitables
         OUTCOME_ASSERT(!result_set.load(std::memory_order_acquire));
         std::rethrow_exception(std::current_exception());  // throws
       }
+      // The awaiter to resume upon completion, if there is one yet
+      coroutine_handle<> take_continuation() noexcept
+      {
+        if(!this->may_have_suspended)
+        {
+          // Any awaiter started us upon this thread before we ran
+          return continuation;
+        }
+        // Pairs with the exchange in the awaitable's await_suspend()
+        return (handoff.exchange(handoff_state::completed, std::memory_order_acq_rel) == handoff_state::awaiter_suspended) ? continuation : coroutine_handle<>();
+      }
       auto initial_suspend() noexcept
       {
         OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(this << " promise initial suspend = " << suspend_initial);
@@ -353,23 +540,25 @@ namespace awaitables
 #if OUTCOME_HAVE_NOOP_COROUTINE
           coroutine_handle<> await_suspend(coroutine_handle<outcome_promise_type> self) noexcept
           {
-            if(self.promise().continuation)
+            auto continuation = self.promise().take_continuation();
+            if(continuation)
             {
-              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << self.promise().continuation.address());
+              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << continuation.address());
             }
             else
             {
               OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will exit");
             }
-            return self.promise().continuation ? self.promise().continuation : noop_coroutine();
+            return continuation ? continuation : noop_coroutine();
           }
 #else
           void await_suspend(coroutine_handle<outcome_promise_type> self)
           {
-            if(self.promise().continuation)
+            auto continuation = self.promise().take_continuation();
+            if(continuation)
             {
-              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << self.promise().continuation.address());
-              return self.promise().continuation.resume();
+              OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&self.promise() << " promise final suspend will resume coroutine " << continuation.address());
+              return continuation.resume();
             }
             else
             {
@@ -398,9 +587,12 @@ namespace awaitables
       using executor_type = Executor;
       using promise_type = outcome_promise_type<awaitable, suspend_initial, use_atomic, std::is_void<container_type>::value>;
       coroutine_handle<promise_type> _h;
+      // Set if a stop was requested before this lazy awaitable was ever started
+      bool _canceled{false};
 
       awaitable(awaitable &&o) noexcept
           : _h(static_cast<coroutine_handle<promise_type> &&>(o._h))
+          , _canceled(o._canceled)
       {
         o._h = nullptr;
       }
@@ -430,6 +622,13 @@ namespace awaitables
       container_type await_resume()
       {
         OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise() << " await_resume");
+        if constexpr(is_cancellable<container_type>::value)
+        {
+          if(_canceled)
+          {
+            return container_type(cancellation_traits<typename container_type::error_type>::make());
+          }
+        }
         OUTCOME_ASSERT(_h.promise().result_set.load(std::memory_order_acquire));
         if(!_h.promise().result_set.load(std::memory_order_acquire))
         {
@@ -438,37 +637,163 @@ namespace awaitables
         return detail::move_result_from_promise_if_not_void(_h.promise());
       }
 #if OUTCOME_HAVE_NOOP_COROUTINE
-      coroutine_handle<> await_suspend(coroutine_handle<> cont) noexcept
+      coroutine_handle<> await_suspend(coroutine_handle<> cont) noexcept { return _await_suspend(cont, nullptr); }
+      // Awaited from a coroutine with a stop state, which we inherit
+      template <class Promise> coroutine_handle<> await_suspend(coroutine_handle<Promise> cont) noexcept
+      {
+        return _await_suspend(cont, detail::stop_state_of(cont.promise(), 0));
+      }
+      coroutine_handle<> _await_suspend(coroutine_handle<> cont, const stop_state *parent_stop) noexcept
       {
         OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise() << " await_suspend suspends coroutine " << cont.address());
         auto &p = _h.promise();
+        if(p.stop == nullptr)
+        {
+          p.stop = parent_stop;
+        }
         p.continuation = cont;
-        bool expected = true;
-        if(p.pending_first_resumption.compare_exchange_strong(expected, false, std::memory_order_acq_rel, std::memory_order_relaxed))
+        // Only the awaiter ever touches this, so it needs no read-modify-write
+        if(p.pending_first_resumption.load(std::memory_order_relaxed))
         {
+          p.pending_first_resumption.store(false, std::memory_order_relaxed);
+          // The coroutine has not begun, so it cannot complete concurrently with us
+          p.handoff.store(handoff_state::awaiter_suspended, std::memory_order_relaxed);
+          if(is_cancellable<container_type>::value && p.stop != nullptr && p.stop->stop_requested())
+          {
+            OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise() << " await_suspend cancels initially suspended coroutine " << _h.address());
+            _canceled = true;
+            return cont;
+          }
           OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise()
                                               << " await_suspend does one time first resumption of initially suspended coroutine " << _h.address());
           return _h;
         }
+        // The coroutine suspended part way through, and may complete upon another thread
+        if(p.handoff.exchange(handoff_state::awaiter_suspended, std::memory_order_acq_rel) == handoff_state::completed)
+        {
+          OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise() << " await_suspend found coroutine " << _h.address() << " completed, resuming " << cont.address());
+          return cont;
+        }
         return noop_coroutine();
       }
 #else
-      void await_suspend(coroutine_handle<> cont)
+      void await_suspend(coroutine_handle<> cont) { _await_suspend(cont, nullptr); }
+      // Awaited from a coroutine with a stop state, which we inherit
+      template <class Promise> void await_suspend(coroutine_handle<Promise> cont) { _await_suspend(cont, detail::stop_state_of(cont.promise(), 0)); }
+      void _await_suspend(coroutine_handle<> cont, const stop_state *parent_stop)
       {
         OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise() << " await_suspend suspends coroutine " << cont.address());
         auto &p = _h.promise();
+        if(p.stop == nullptr)
+        {
+          p.stop = parent_stop;
+        }
         p.continuation = cont;
-        bool expected = true;
-        if(p.pending_first_resumption.compare_exchange_strong(expected, false, std::memory_order_acq_rel, std::memory_order_relaxed))
+        // Only the awaiter ever touches this, so it needs no read-modify-write
+        if(p.pending_first_resumption.load(std::memory_order_relaxed))
         {
+          p.pending_first_resumption.store(false, std::memory_order_relaxed);
+          // The coroutine has not begun, so it cannot complete concurrently with us
+          p.handoff.store(handoff_state::awaiter_suspended, std::memory_order_relaxed);
+          if(is_cancellable<container_type>::value && p.stop != nullptr && p.stop->stop_requested())
+          {
+            OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise() << " await_suspend cancels initially suspended coroutine " << _h.address());
+            _canceled = true;
+            return cont.resume();
+          }
           OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise()
                                               << " await_suspend does one time first resumption of initially suspended coroutine " << _h.address());
-          _h.resume();
+          return _h.resume();
+        }
+        // The coroutine suspended part way through, and may complete upon another thread
+        if(p.handoff.exchange(handoff_state::awaiter_suspended, std::memory_order_acq_rel) == handoff_state::completed)
+        {
+          OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(&_h.promise() << " await_suspend found coroutine " << _h.address() << " completed, resuming " << cont.address());
+          return cont.resume();
         }
       }
 #endif
     };
 
+    /* A lazy awaitable which cannot be moved, so its coroutine frame provably lives no longer
+    than the scope awaiting it. This lets the compiler elide the frame's dynamic allocation.
+    As it is always started by its awaiter, which has published its continuation beforehand,
+    no atomics are needed even if the coroutine completes upon another thread.
+    */
+    template <class Cont, class Executor> struct OUTCOME_NODISCARD OUTCOME_CORO_AWAIT_ELIDABLE scoped_awaitable
+    {
+      using container_type = Cont;
+      using value_type = Cont;
+      using executor_type = Executor;
+      using promise_type = outcome_promise_type<scoped_awaitable, true, false, std::is_void<container_type>::value>;
+      coroutine_handle<promise_type> _h;
+      bool _canceled{false};
+
+      explicit scoped_awaitable(promise_type &p) noexcept
+          : _h(coroutine_handle<promise_type>::from_promise(p))
+      {
+      }
+      scoped_awaitable(scoped_awaitable &&) = delete;
+      scoped_awaitable(const scoped_awaitable &) = delete;
+      scoped_awaitable &operator=(scoped_awaitable &&) = delete;
+      scoped_awaitable &operator=(const scoped_awaitable &) = delete;
+      ~scoped_awaitable() { _h.destroy(); }
+      constexpr bool await_ready() noexcept { return false; }
+      container_type await_resume()
+      {
+        if constexpr(is_cancellable<container_type>::value)
+        {
+          if(_canceled)
+          {
+            return container_type(cancellation_traits<typename container_type::error_type>::make());
+          }
+        }
+        return detail::move_result_from_promise_if_not_void(_h.promise());
+      }
+#if OUTCOME_HAVE_NOOP_COROUTINE
+      coroutine_handle<> await_suspend(coroutine_handle<> cont) noexcept { return _await_suspend(cont, nullptr); }
+      template <class Promise> coroutine_handle<> await_suspend(coroutine_handle<Promise> cont) noexcept
+      {
+        return _await_suspend(cont, detail::stop_state_of(cont.promise(), 0));
+      }
+      coroutine_handle<> _await_suspend(coroutine_handle<> cont, const stop_state *parent_stop) noexcept
+      {
+        if(_start(cont, parent_stop))
+        {
+          return _h;
+        }
+        return cont;
+      }
+#else
+      void await_suspend(coroutine_handle<> cont) { _await_suspend(cont, nullptr); }
+      template <class Promise> void await_suspend(coroutine_handle<Promise> cont) { _await_suspend(cont, detail::stop_state_of(cont.promise(), 0)); }
+      void _await_suspend(coroutine_handle<> cont, const stop_state *parent_stop)
+      {
+        if(_start(cont, parent_stop))
+        {
+          return _h.resume();
+        }
+        return cont.resume();
+      }
+#endif
+      // Returns false if cancelled instead of started
+      bool _start(coroutine_handle<> cont, const stop_state *parent_stop) noexcept
+      {
+        auto &p = _h.promise();
+        OUTCOME_ASSERT(p.pending_first_resumption.load(std::memory_order_relaxed));
+        p.pending_first_resumption.store(false, std::memory_order_relaxed);
+        p.stop = parent_stop;
+        if(is_cancellable<container_type>::value && parent_stop != nullptr && parent_stop->stop_requested())
+        {
+          _canceled = true;
+          return false;
+        }
+        p.continuation = cont;
+        p.handoff.store(handoff_state::awaiter_suspended, std::memory_order_relaxed);
+        return true;
+      }
+    };
+
     template <class ContType, class Executor, bool suspend_initial, bool use_atomic> struct generator
     {
       using container_type = ContType;
@@ -654,6 +979,543 @@ namespace awaitables
       }
 #endif
     };
+    template <class ContType, class Executor, bool use_atomic> struct async_generator
+    {
+      using container_type = ContType;
+      using value_type = ContType;
+      using executor_type = Executor;
+      class promise_type
+      {
+        friend struct async_generator;
+        using result_set_type = std::conditional_t<use_atomic, std::atomic<int8_t>, fake_atomic<int8_t>>;
+        union
+        {
+          OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
+          container_type result;
+        };
+        // 0 = no item, 1 = item awaiting consumption, -1 = no more items
+        result_set_type result_set{0};
+        // Set when the item just yielded is a failure, after which the producer is never resumed again
+        bool stop_after_current{false};
+        coroutine_handle<> continuation;
+
+        struct yield_awaiter
+        {
+          bool await_ready() noexcept { return false; }
+          void await_resume() noexcept {}
+#if OUTCOME_HAVE_NOOP_COROUTINE
+          coroutine_handle<> await_suspend(coroutine_handle<promise_type> self) noexcept
+          {
+            return self.promise().continuation ? self.promise().continuation : noop_coroutine();
+          }
+#else
+          void await_suspend(coroutine_handle<promise_type> self)
+          {
+            if(self.promise().continuation)
+            {
+              return self.promise().continuation.resume();
+            }
+          }
+#endif
+        };
+
+        void _store(container_type &&value)
+        {
+          new(&result) container_type(static_cast<container_type &&>(value));  // could throw
+          stop_after_current = detail::is_failed_item(result, 0);
+          result_set.store(1, std::memory_order_release);
+        }
+        void _store(const container_type &value)
+        {
+          new(&result) container_type(value);  // could throw
+          stop_after_current = detail::is_failed_item(result, 0);
+          result_set.store(1, std::memory_order_release);
+        }
+
+      public:
+        promise_type() {}
+        promise_type(const promise_type &) = delete;
+        promise_type(promise_type &&) = delete;
+        promise_type &operator=(const promise_type &) = delete;
+        promise_type &operator=(promise_type &&) = delete;
+        ~promise_type()
+        {
+          if(result_set.load(std::memory_order_acquire) == 1)
+          {
+            result.~container_type();  // could throw
+          }
+        }
+
+        auto get_return_object()
+        {
+          return async_generator{*this};  // could throw bad_alloc
+        }
+        void return_void() noexcept
+        {
+          OUTCOME_ASSERT(result_set.load(std::memory_order_acquire) == 0);
+          result_set.store(-1, std::memory_order_release);
+        }
+        yield_awaiter yield_value(container_type &&value)
+        {
+          // The consumer must have taken the previous item before resuming us
+          OUTCOME_ASSERT(result_set.load(std::memory_order_acquire) == 0);
+          _store(static_cast<container_type &&>(value));
+          return {};
+        }
+        yield_awaiter yield_value(const container_type &value)
+        {
+          OUTCOME_ASSERT(result_set.load(std::memory_order_acquire) == 0);
+          _store(value);
+          return {};
+        }
+        void unhandled_exception()
+        {
+          OUTCOME_ASSERT(result_set.load(std::memory_order_acquire) == 0);
+#ifdef __cpp_exceptions
+          auto e = std::current_exception();
+          auto ec = detail::error_from_exception(static_cast<decltype(e) &&>(e), {});
+          // Try to set error code first
+          if(!detail::error_is_set(ec) || !detail::try_set_error(static_cast<decltype(ec) &&>(ec), &result))
+          {
+            detail::set_or_rethrow(e, &result);  // could throw
+          }
+#else
+          std::terminate();
+#endif
+          stop_after_current = true;
+          result_set.store(1, std::memory_order_release);
+        }
+        // Never begin producing until the first item is asked for
+        suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept
+        {
+          struct awaiter
+          {
+            bool await_ready() noexcept { return false; }
+            void await_resume() noexcept {}
+#if OUTCOME_HAVE_NOOP_COROUTINE
+            coroutine_handle<> await_suspend(coroutine_handle<promise_type> self) noexcept
+            {
+              return self.promise().continuation ? self.promise().continuation : noop_coroutine();
+            }
+#else
+            void await_suspend(coroutine_handle<promise_type> self)
+            {
+              if(self.promise().continuation)
+              {
+                return self.promise().continuation.resume();
+              }
+            }
+#endif
+          };
+          return awaiter{};
+        }
+      };
+      coroutine_handle<promise_type> _h;
+
+      async_generator(async_generator &&o) noexcept
+          : _h(static_cast<coroutine_handle<promise_type> &&>(o._h))
+      {
+        o._h = nullptr;
+      }
+      async_generator(const async_generator &o) = delete;
+      async_generator &operator=(async_generator &&) = delete;  // as per P1056
+      async_generator &operator=(const async_generator &) = delete;
+      ~async_generator()
+      {
+        if(_h)
+        {
+          _h.destroy();
+        }
+      }
+      explicit async_generator(promise_type &p)  // could throw
+          : _h(coroutine_handle<promise_type>::from_promise(p))
+      {
+      }
+
+      //! Awaitable returned by `next()`. Resumes to true if an item is available.
+      struct next_awaitable
+      {
+        coroutine_handle<promise_type> _h;
+
+        bool await_ready() noexcept
+        {
+          auto &p = _h.promise();
+          // Ready if an unconsumed item is pending, or if the producer has nothing more to give
+          return p.result_set.load(std::memory_order_acquire) != 0 || _h.done();
+        }
+        bool await_resume() noexcept { return _h.promise().result_set.load(std::memory_order_acquire) == 1; }
+#if OUTCOME_HAVE_NOOP_COROUTINE
+        coroutine_handle<> await_suspend(coroutine_handle<> cont) noexcept
+        {
+          _h.promise().continuation = cont;
+          return _h;
+        }
+#else
+        void await_suspend(coroutine_handle<> cont)
+        {
+          _h.promise().continuation = cont;
+          _h.resume();
+        }
+#endif
+      };
+
+      bool valid() const noexcept { return _h != nullptr; }
+      //! True if the producer has finished, and the final item (if any) has been consumed.
+      bool done() const noexcept { return !_h || _h.promise().result_set.load(std::memory_order_acquire) < 0; }
+      //! Returns an awaitable which resumes the producer until it yields its next item.
+      next_awaitable next() noexcept { return next_awaitable{_h}; }
+      //! Moves out the item made available by the most recent `co_await next()`.
+      container_type operator()()  // could throw
+      {
+        auto &p = _h.promise();
+        OUTCOME_ASSERT(p.result_set.load(std::memory_order_acquire) == 1);
+        if(p.result_set.load(std::memory_order_acquire) != 1)
+        {
+          std::terminate();
+        }
+        container_type ret(static_cast<container_type &&>(p.result));
+        p.result.~container_type();  // could throw
+        // Once a failure has been handed out, the producer is never resumed again
+        p.result_set.store(p.stop_after_current ? -1 : 0, std::memory_order_release);
+        return ret;
+      }
+    };
+
+    // Shared by when_all() and when_any(). The group is decided by the first child to complete
+    // with a failure (when_all) or a success (when_any), after which no further lazy children
+    // are started.
+    template <bool use_atomic> struct group_state
+    {
+      static constexpr size_t undecided = static_cast<size_t>(-1);
+      using counter_type = std::conditional_t<use_atomic, std::atomic<size_t>, fake_atomic<size_t>>;
+      counter_type remaining{0}, decided{undecided};
+      coroutine_handle<> parent;
+      // Requested when the group is decided, so children still in flight can stop early
+      stop_state stop;
+
+      void decide(size_t idx) noexcept
+      {
+        size_t expected = undecided;
+        if(decided.compare_exchange_strong(expected, idx, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+          stop.request_stop();
+        }
+      }
+      bool is_decided() noexcept { return decided.load(std::memory_order_acquire) != undecided; }
+      // True if the caller completed the last outstanding child
+      bool complete_one() noexcept { return remaining.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+    };
+
+    // A minimal coroutine which awaits one child of a group, then tells the group. The child's
+    // continuation is pointed at this, so completion of the last child resumes the group's parent.
+    template <class State> struct group_task
+    {
+      struct promise_type
+      {
+        State *state;
+
+        template <class... Args>
+        explicit promise_type(State *s, Args &&... /*unused*/) noexcept
+            : state(s)
+        {
+        }
+        group_task get_return_object() noexcept { return group_task{coroutine_handle<promise_type>::from_promise(*this)}; }
+        suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept
+        {
+          struct awaiter
+          {
+            bool await_ready() noexcept { return false; }
+            void await_resume() noexcept {}
+#if OUTCOME_HAVE_NOOP_COROUTINE
+            coroutine_handle<> await_suspend(coroutine_handle<promise_type> self) noexcept
+            {
+              auto *state = self.promise().state;
+              return state->complete_one() ? state->parent : noop_coroutine();
+            }
+#else
+            void await_suspend(coroutine_handle<promise_type> self)
+            {
+              auto *state = self.promise().state;
+              if(state->complete_one())
+              {
+                return state->parent.resume();
+              }
+            }
+#endif
+          };
+          return awaiter{};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+      };
+      coroutine_handle<promise_type> _h;
+
+      group_task() = default;
+      explicit group_task(coroutine_handle<promise_type> h) noexcept
+          : _h(h)
+      {
+      }
+      group_task(group_task &&o) noexcept
+          : _h(static_cast<coroutine_handle<promise_type> &&>(o._h))
+      {
+        o._h = nullptr;
+      }
+      group_task(const group_task &) = delete;
+      group_task &operator=(group_task &&o) noexcept
+      {
+        if(this != &o)
+        {
+          this->~group_task();
+          new(this) group_task(static_cast<group_task &&>(o));
+        }
+        return *this;
+      }
+      group_task &operator=(const group_task &) = delete;
+      ~group_task()
+      {
+        if(_h)
+        {
+          _h.destroy();
+        }
+      }
+    };
+    // Waits for an awaitable to complete without consuming its result
+    template <class Awaitable> struct wait_for_completion
+    {
+      Awaitable &aw;
+      bool await_ready() noexcept { return aw.await_ready(); }
+      auto await_suspend(coroutine_handle<> cont) noexcept(noexcept(aw.await_suspend(cont))) { return aw.await_suspend(cont); }
+      void await_resume() noexcept {}
+    };
+    // True if a completed child of a group failed. Children returning void cannot fail.
+    template <class Awaitable> inline bool group_child_failed(Awaitable &aw) noexcept
+    {
+      if constexpr(std::is_void<typename Awaitable::container_type>::value)
+      {
+        return false;
+      }
+      else
+      {
+        // A child which was canceled before it started has no result, but counts as a failure
+        return aw._canceled || detail::is_failed_item(aw._h.promise().result, 0);
+      }
+    }
+    template <bool decide_on_failure, class State, class Awaitable> inline group_task<State> group_join(State *state, size_t idx, Awaitable *aw)
+    {
+      co_await wait_for_completion<Awaitable>{*aw};
+      if(group_child_failed(*aw) == decide_on_failure)
+      {
+        state->decide(idx);
+      }
+    }
+
+    template <bool decide_on_failure, class... Awaitables> struct group_awaitable_base
+    {
+      static_assert(sizeof...(Awaitables) > 0, "Must await at least one awaitable");
+      static constexpr bool use_atomic = (false || ... || Awaitables::promise_type::is_using_atomics);
+      using state_type = group_state<use_atomic>;
+
+      std::tuple<Awaitables...> _children;
+      state_type _state;
+      std::array<group_task<state_type>, sizeof...(Awaitables)> _tasks;
+
+      explicit group_awaitable_base(Awaitables &&... aws)
+          : _children(static_cast<Awaitables &&>(aws)...)
+      {
+      }
+      group_awaitable_base(group_awaitable_base &&) = default;
+      group_awaitable_base(const group_awaitable_base &) = delete;
+      group_awaitable_base &operator=(group_awaitable_base &&) = delete;
+      group_awaitable_base &operator=(const group_awaitable_base &) = delete;
+
+      bool await_ready() noexcept
+      {
+        if(!_all_ready(std::index_sequence_for<Awaitables...>{}))
+        {
+          return false;
+        }
+        // await_suspend() won't be called, so decide the group here
+        _decide_ready(std::index_sequence_for<Awaitables...>{});
+        return true;
+      }
+      // Awaited from a coroutine with a stop state, a stop request to which also stops our children
+      template <class Promise> bool await_suspend(coroutine_handle<Promise> cont)  // could throw bad_alloc
+      {
+        _state.stop.parent = detail::stop_state_of(cont.promise(), 0);
+        return await_suspend(coroutine_handle<>(cont));
+      }
+      bool await_suspend(coroutine_handle<> cont)  // could throw bad_alloc
+      {
+        _state.parent = cont;
+        // One extra count prevents the parent being resumed until all children have been started
+        _state.remaining.store(sizeof...(Awaitables) + 1, std::memory_order_release);
+        _start(std::index_sequence_for<Awaitables...>{});
+        // If every child has already completed, don't suspend
+        return !_state.complete_one();
+      }
+
+    private:
+      template <size_t... Is> bool _all_ready(std::index_sequence<Is...> /*unused*/) noexcept { return (true && ... && std::get<Is>(_children).await_ready()); }
+      template <size_t... Is> void _decide_ready(std::index_sequence<Is...> /*unused*/) noexcept { (_decide_one<Is>(), ...); }
+      template <size_t I> void _decide_one() noexcept
+      {
+        if(group_child_failed(std::get<I>(_children)) == decide_on_failure)
+        {
+          _state.decide(I);
+        }
+      }
+      template <size_t... Is> void _start(std::index_sequence<Is...> /*unused*/) { (_start_one<Is>(), ...); }
+      template <size_t I> void _start_one()
+      {
+        auto &child = std::get<I>(_children);
+        auto &p = child._h.promise();
+        if(child.await_ready())
+        {
+          // Already complete, no need to wait on it
+          _decide_one<I>();
+          _state.complete_one();
+          return;
+        }
+        if(_state.is_decided() && p.pending_first_resumption.load(std::memory_order_acquire))
+        {
+          // Outcome of the group is already known, so never start this lazy child
+          _state.complete_one();
+          return;
+        }
+        p.stop = &_state.stop;
+        _tasks[I] = group_join<decide_on_failure>(&_state, I, &child);
+        _tasks[I]._h.resume();
+      }
+    };
+
+    // Children returning void, or a container of void, contribute void_type to when_all()'s tuple
+    template <class T> struct value_or_void_type
+    {
+      using type = OUTCOME_V2_NAMESPACE::detail::devoid<typename T::value_type>;
+    };
+    template <> struct value_or_void_type<void>
+    {
+      using type = OUTCOME_V2_NAMESPACE::detail::devoid<void>;
+    };
+    template <class T> using value_or_void_type_t = typename value_or_void_type<T>::type;
+    template <class... Conts> struct first_non_void_container
+    {
+      using type = void;
+    };
+    template <class Cont, class... Conts> struct first_non_void_container<Cont, Conts...>
+    {
+      using type = Cont;
+    };
+    template <class... Conts> struct first_non_void_container<void, Conts...> : first_non_void_container<Conts...>
+    {
+    };
+
+    template <class... Awaitables> struct OUTCOME_NODISCARD when_all_awaitable : group_awaitable_base<true, Awaitables...>
+    {
+      using _base = group_awaitable_base<true, Awaitables...>;
+      using first_container_type = typename first_non_void_container<typename Awaitables::container_type...>::type;
+      static_assert(!std::is_void<first_container_type>::value, "when_all() requires at least one awaitable whose container_type is not void");
+      using container_type = typename first_container_type::template rebind<std::tuple<value_or_void_type_t<typename Awaitables::container_type>...>>;
+      using value_type = container_type;
+
+      using _base::_base;
+
+      container_type await_resume()
+      {
+        auto idx = this->_state.decided.load(std::memory_order_acquire);
+        if(idx != _base::state_type::undecided)
+        {
+          return _failure<0>(idx);
+        }
+        return _success(std::index_sequence_for<Awaitables...>{});
+      }
+
+    private:
+      template <size_t I> container_type _failure(size_t idx)
+      {
+        if constexpr(I + 1 < sizeof...(Awaitables))
+        {
+          if(idx != I)
+          {
+            return _failure<I + 1>(idx);
+          }
+        }
+        if constexpr(std::is_void<typename std::tuple_element_t<I, std::tuple<Awaitables...>>::container_type>::value)
+        {
+          // Never reached, as children returning void cannot fail
+          std::terminate();
+        }
+        else
+        {
+          return container_type(std::get<I>(this->_children).await_resume().as_failure());
+        }
+      }
+      template <size_t I> auto _value()
+      {
+        auto &child = std::get<I>(this->_children);
+        using child_container_type = typename std::tuple_element_t<I, std::tuple<Awaitables...>>::container_type;
+        if constexpr(std::is_void<child_container_type>::value)
+        {
+          child.await_resume();
+          return OUTCOME_V2_NAMESPACE::detail::void_type{};
+        }
+        else if constexpr(std::is_void<typename child_container_type::value_type>::value)
+        {
+          (void) child.await_resume();
+          return OUTCOME_V2_NAMESPACE::detail::void_type{};
+        }
+        else
+        {
+          return typename child_container_type::value_type(child.await_resume().assume_value());
+        }
+      }
+      template <size_t... Is> container_type _success(std::index_sequence<Is...> /*unused*/)
+      {
+        return container_type(in_place_type<typename container_type::value_type>, _value<Is>()...);
+      }
+    };
+
+    template <class... Awaitables> struct OUTCOME_NODISCARD when_any_awaitable : group_awaitable_base<false, Awaitables...>
+    {
+      using _base = group_awaitable_base<false, Awaitables...>;
+      using container_type = typename std::tuple_element_t<0, std::tuple<Awaitables...>>::container_type;
+      static_assert((true && ... && std::is_same<container_type, typename Awaitables::container_type>::value),
+                    "when_any() requires all awaitables to have the same container_type");
+      using value_type = container_type;
+
+      using _base::_base;
+
+      container_type await_resume()
+      {
+        auto idx = this->_state.decided.load(std::memory_order_acquire);
+        // If nothing succeeded, every child was run, so return the failure of the first
+        return _get<0>((idx != _base::state_type::undecided) ? idx : 0);
+      }
+
+    private:
+      template <size_t I> container_type _get(size_t idx)
+      {
+        if constexpr(I + 1 < sizeof...(Awaitables))
+        {
+          if(idx != I)
+          {
+            return _get<I + 1>(idx);
+          }
+        }
+        return std::get<I>(this->_children).await_resume();
+      }
+    };
+
+    template <class... Awaitables> inline when_all_awaitable<std::decay_t<Awaitables>...> when_all(Awaitables &&... aws)
+    {
+      return when_all_awaitable<std::decay_t<Awaitables>...>(static_cast<Awaitables &&>(aws)...);
+    }
+    template <class... Awaitables> inline when_any_awaitable<std::decay_t<Awaitables>...> when_any(Awaitables &&... aws)
+    {
+      return when_any_awaitable<std::decay_t<Awaitables>...>(static_cast<Awaitables &&>(aws)...);
+    }
 #endif
   }  // namespace detail
 
@@ -685,10 +1547,40 @@ SIGNATURE NOT RECOGNISED
 */
 template <class T, class Executor = void> using atomic_lazy = OUTCOME_V2_NAMESPACE::awaitables::detail::awaitable<T, Executor, true, true>;
 
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T, class Executor = void> using scoped_lazy = OUTCOME_V2_NAMESPACE::awaitables::detail::scoped_awaitable<T, Executor>;
+
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
 template <class T, class Executor = void> using generator = OUTCOME_V2_NAMESPACE::awaitables::detail::generator<T, Executor, true, false>;
 
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T, class Executor = void> using async_generator = OUTCOME_V2_NAMESPACE::awaitables::detail::async_generator<T, Executor, false>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+using OUTCOME_V2_NAMESPACE::awaitables::detail::when_all;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+using OUTCOME_V2_NAMESPACE::awaitables::detail::when_any;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+using OUTCOME_V2_NAMESPACE::awaitables::detail::stop_token;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+using OUTCOME_V2_NAMESPACE::awaitables::detail::get_stop_token;
+
 OUTCOME_COROUTINE_SUPPORT_NAMESPACE_END
 #endif
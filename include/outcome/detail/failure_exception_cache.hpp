@@ -0,0 +1,127 @@
+/* Cache of the exceptions synthesised by failure()
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_FAILURE_EXCEPTION_CACHE_HPP
+#define OUTCOME_FAILURE_EXCEPTION_CACHE_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#ifndef OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES
+#define OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES 64
+#endif
+#ifndef OUTCOME_FAILURE_EXCEPTION_CACHE_PROBES
+#define OUTCOME_FAILURE_EXCEPTION_CACHE_PROBES 4
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  /* A bounded process wide cache of the exceptions synthesised from error codes, keyed on
+  the identity of their category and their value. It is lock free and insert only: entries
+  are never replaced nor freed, so a reader can never see one being destroyed, and at most
+  OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES exceptions are kept for the lifetime of the
+  process. Exceptions which do not fit into the cache are synthesised every time. Tag
+  separates caches whose keys are not comparable.
+  */
+  template <class Tag, class ExceptionPtr> class failure_exception_cache
+  {
+    struct entry_type
+    {
+      uint64_t key;
+      intptr_t value;
+      ExceptionPtr ptr;
+    };
+    std::atomic<entry_type *> _entries[OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES];
+
+    constexpr failure_exception_cache() noexcept
+        : _entries{}
+    {
+    }
+
+  public:
+    failure_exception_cache(const failure_exception_cache &) = delete;
+    failure_exception_cache(failure_exception_cache &&) = delete;
+    failure_exception_cache &operator=(const failure_exception_cache &) = delete;
+    failure_exception_cache &operator=(failure_exception_cache &&) = delete;
+    ~failure_exception_cache() = default;
+
+    // Constant initialised and trivially destructible, so usable during static deinitialisation
+    static failure_exception_cache &get() noexcept
+    {
+      static failure_exception_cache v;
+      return v;
+    }
+
+    template <class F> ExceptionPtr lookup(uint64_t key, intptr_t value, F &&make_exception)
+    {
+      const uint64_t hash = (key ^ static_cast<uint64_t>(value)) * 0x9E3779B97F4A7C15ULL;
+      const size_t idx = static_cast<size_t>(hash >> 32U) % OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES;
+      for(size_t n = 0; n < OUTCOME_FAILURE_EXCEPTION_CACHE_PROBES && n < OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES; n++)
+      {
+        // Entries are filled in probe order, so an empty entry ends the search
+        const entry_type *e = _entries[(idx + n) % OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES].load(std::memory_order_acquire);
+        if(e == nullptr)
+        {
+          break;
+        }
+        if(e->key == key && e->value == value)
+        {
+          return e->ptr;
+        }
+      }
+      ExceptionPtr ptr = make_exception();
+      auto *ne = new(std::nothrow) entry_type{key, value, ptr};
+      if(ne == nullptr)
+      {
+        return ptr;
+      }
+      for(size_t n = 0; n < OUTCOME_FAILURE_EXCEPTION_CACHE_PROBES && n < OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES; n++)
+      {
+        entry_type *expected = nullptr;
+        if(_entries[(idx + n) % OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES].compare_exchange_strong(expected, ne, std::memory_order_acq_rel,
+                                                                                                  std::memory_order_acquire))
+        {
+          return ptr;
+        }
+        if(expected->key == key && expected->value == value)
+        {
+          // Another thread cached this error code first
+          delete ne;
+          return expected->ptr;
+        }
+      }
+      delete ne;
+      return ptr;
+    }
+  };
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,69 @@
+/* Headers to include into the global module fragment of Outcome's module interface units
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_GLOBAL_MODULE_FRAGMENT_HPP
+#define OUTCOME_DETAIL_GLOBAL_MODULE_FRAGMENT_HPP
+
+/* Every header not belonging to Outcome which Outcome includes must be
+included here, before the module declaration, otherwise GCC and clang attach
+its declarations to Outcome's module and then fail when an importer includes
+it as well. MSVC has its own header for this, as it can use all of the standard
+library.
+*/
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <__msvc_all_public_headers.hpp>
+#else
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <iosfwd>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if __has_include(<coroutine>)
+#include <coroutine>
+#elif __has_include(<experimental/coroutine>)
+#include <experimental/coroutine>
+#endif
+#endif
+
+#include "quickcpplib/config.hpp"
+#include "quickcpplib/import.h"
+
+#endif
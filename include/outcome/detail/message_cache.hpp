@@ -0,0 +1,106 @@
+/* A per thread cache of error code messages
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_MESSAGE_CACHE_HPP
+#define OUTCOME_MESSAGE_CACHE_HPP
+
+#include "../config.hpp"
+
+#include <cstdint>
+#include <string>
+
+#ifndef OUTCOME_MESSAGE_CACHE_ENTRIES
+#define OUTCOME_MESSAGE_CACHE_ENTRIES 512
+#endif
+#ifndef OUTCOME_MESSAGE_CACHE_PROBES
+#define OUTCOME_MESSAGE_CACHE_PROBES 16
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  /* A bounded per thread cache of the messages of error codes, keyed on the identity
+  of their category or domain, and their value. Each message is rendered at most once
+  per thread, and the returned reference remains valid until the thread exits. Messages
+  which do not fit into the cache are rendered into a scratch string, which remains valid
+  only until the next message which does not fit. Tag separates caches whose keys are
+  not comparable.
+  */
+  template <class Tag> class message_cache
+  {
+    struct entry_type
+    {
+      bool used{false};
+      uint64_t key{0};
+      intptr_t value{0};
+      std::string message;
+    };
+    entry_type _entries[OUTCOME_MESSAGE_CACHE_ENTRIES];
+    std::string _scratch;
+
+    message_cache() = default;
+
+  public:
+    message_cache(const message_cache &) = delete;
+    message_cache(message_cache &&) = delete;
+    message_cache &operator=(const message_cache &) = delete;
+    message_cache &operator=(message_cache &&) = delete;
+    ~message_cache() = default;
+
+    static message_cache &get() noexcept
+    {
+      static thread_local message_cache v;
+      return v;
+    }
+
+    template <class F> const std::string &lookup(uint64_t key, intptr_t value, F &&make_message)
+    {
+      const uint64_t hash = (key ^ static_cast<uint64_t>(value)) * 0x9E3779B97F4A7C15ULL;
+      const size_t idx = static_cast<size_t>(hash >> 32U) % OUTCOME_MESSAGE_CACHE_ENTRIES;
+      for(size_t n = 0; n < OUTCOME_MESSAGE_CACHE_PROBES && n < OUTCOME_MESSAGE_CACHE_ENTRIES; n++)
+      {
+        entry_type &e = _entries[(idx + n) % OUTCOME_MESSAGE_CACHE_ENTRIES];
+        if(!e.used)
+        {
+          e.message = make_message();
+          e.key = key;
+          e.value = value;
+          e.used = true;
+          return e.message;
+        }
+        if(e.key == key && e.value == value)
+        {
+          return e.message;
+        }
+      }
+      _scratch = make_message();
+      return _scratch;
+    }
+  };
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
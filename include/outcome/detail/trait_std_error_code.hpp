@@ -29,7 +29,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <system_error>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
@@ -60,6 +60,11 @@ namespace detail
       state._status.set_have_error_is_errno(true);
    }
 
+  // Customise _errno_value, only ever called if have_error_is_errno
+  template <class State> inline int _errno_value(const State & /*unused*/, const std::error_code &error) noexcept { return error.value(); }
+  template <class State> inline int _errno_value(const State & /*unused*/, const std::error_condition &error) noexcept { return error.value(); }
+  template <class State> constexpr inline int _errno_value(const State & /*unused*/, const std::errc &error) noexcept { return static_cast<int>(error); }
+
 }  // namespace detail
 
 namespace policy
@@ -381,7 +381,49 @@ namespace detail
   static_assert(std::is_standard_layout<status_bitfield_type>::value, "status_bitfield_type is not a standard layout type!");
 #endif
 
-  template <class State> constexpr inline void _set_error_is_errno(State & /*unused*/) {}
+  // Customisation point, overloaded for error types which can carry an errno to set have_error_is_errno
+  struct _set_error_is_errno_any_error
+  {
+    template <class T>
+    constexpr _set_error_is_errno_any_error(const T & /*unused*/) noexcept  // NOLINT
+    {
+    }
+  };
+  template <class State> constexpr inline void _set_error_is_errno(State & /*unused*/, _set_error_is_errno_any_error /*unused*/) {}
+
+  // The status of a newly constructed error. The customisation point sees a local state rather than the storage, so
+  // the optimiser knows which bits may be set even when deciding errno calls out of line.
+  struct _error_status_state
+  {
+    status_bitfield_type _status;
+  };
+  template <class E> constexpr inline status_bitfield_type _error_status(const E &error)
+  {
+    _error_status_state state{status_bitfield_type(status::have_error)};
+    _set_error_is_errno(state, error);
+    return state._status;
+  }
+  // The status of storage converted from other storage, whose error type may give errno a different meaning
+  template <class State> constexpr inline status_bitfield_type _converted_status(status_bitfield_type status, const State &state)
+  {
+    return status.set_have_error_is_errno(status.have_error() && _error_status(state._error).have_error_is_errno());
+  }
+
+  // Customisation point, overloaded for error types whose equality can be decided from their errno
+  // values when both have have_error_is_errno, avoiding any more expensive comparison
+  template <bool Equal> struct _error_comparer
+  {
+    template <class A, class B> static constexpr bool compare(const A &a, const B &b) { return a == b; }
+  };
+  template <> struct _error_comparer<false>
+  {
+    template <class A, class B> static constexpr bool compare(const A &a, const B &b) { return a != b; }
+  };
+  template <bool Equal, class A, class B>
+  constexpr inline bool _error_compare(const A &a, status_bitfield_type /*unused*/, const B &b, status_bitfield_type /*unused*/)
+  {
+    return _error_comparer<Equal>::compare(a, b);
+  }
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -445,17 +487,15 @@ namespace detail
     constexpr explicit value_storage_trivial(in_place_type_t<_error_type> /*unused*/,
                                              Args &&...args) noexcept(detail::is_nothrow_constructible<_error_type_, Args...>)
         : _error(static_cast<Args &&>(args)...)
-        , _status(status::have_error)
+        , _status(_error_status(_error))
     {
-      _set_error_is_errno(*this);
     }
     template <class U, class... Args>
     constexpr value_storage_trivial(in_place_type_t<_error_type> /*unused*/, std::initializer_list<U> il,
                                     Args &&...args) noexcept(detail::is_nothrow_constructible<_error_type_, std::initializer_list<U>, Args...>)
         : _error(il, static_cast<Args &&>(args)...)
-        , _status(status::have_error)
+        , _status(_error_status(_error))
     {
-      _set_error_is_errno(*this);
     }
 
     struct nonvoid_converting_constructor_tag
@@ -474,7 +514,7 @@ namespace detail
                                 value_storage_trivial(in_place_type<value_type>, o._value) :
                                 (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, o._error) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
@@ -486,7 +526,7 @@ namespace detail
           value_storage_trivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
           (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
 
     struct void_value_converting_constructor_tag
@@ -503,7 +543,7 @@ namespace detail
                                 value_storage_trivial(in_place_type<value_type>) :
                                 (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, o._error) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_value_converting_constructor<V>))
@@ -514,7 +554,7 @@ namespace detail
           value_storage_trivial(in_place_type<value_type>) :
           (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
 
     struct void_error_converting_constructor_tag
@@ -531,7 +571,7 @@ namespace detail
                                 value_storage_trivial(in_place_type<value_type>, o._value) :
                                 (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class U)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_error_converting_constructor<U>))
@@ -541,7 +581,7 @@ namespace detail
                                 value_storage_trivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
                                 (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     constexpr void swap(value_storage_trivial &o) noexcept
     {
@@ -653,7 +693,7 @@ namespace detail
         : _status(status::have_error)
         , _error(static_cast<Args &&>(args)...)  // NOLINT
     {
-      _set_error_is_errno(*this);
+      _status = _error_status(_error);
     }
     template <class U, class... Args>
     constexpr value_storage_nontrivial(in_place_type_t<_error_type> /*unused*/, std::initializer_list<U> il,
@@ -661,7 +701,7 @@ namespace detail
         : _status(status::have_error)
         , _error(il, static_cast<Args &&>(args)...)
     {
-      _set_error_is_errno(*this);
+      _status = _error_status(_error);
     }
 
     struct nonvoid_converting_constructor_tag
@@ -679,7 +719,7 @@ namespace detail
                                    value_storage_nontrivial(in_place_type<value_type>, o._value) :
                                    (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, o._error) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
@@ -690,7 +730,7 @@ namespace detail
           value_storage_nontrivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
           (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
@@ -700,7 +740,7 @@ namespace detail
                                    value_storage_nontrivial(in_place_type<value_type>, o._value) :
                                    (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, o._error) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
@@ -711,7 +751,7 @@ namespace detail
           value_storage_nontrivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
           (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
 
     struct void_value_converting_constructor_tag
@@ -733,7 +773,7 @@ namespace detail
       {
         new(OUTCOME_ADDRESS_OF(_error)) _error_type_(o._error);  // NOLINT
       }
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_value_converting_constructor<V>))
@@ -748,7 +788,7 @@ namespace detail
       {
         new(OUTCOME_ADDRESS_OF(_error)) _error_type_(static_cast<_error_type_ &&>(o._error));  // NOLINT
       }
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
       o._status.set_have_moved_from(true);
     }
 
@@ -771,7 +811,7 @@ namespace detail
       {
         new(OUTCOME_ADDRESS_OF(_error)) _error_type_();  // NOLINT
       }
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
     }
     OUTCOME_TEMPLATE(class U)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_error_converting_constructor<U>))
@@ -786,7 +826,7 @@ namespace detail
       {
         new(OUTCOME_ADDRESS_OF(_error)) _error_type_();  // NOLINT
       }
-      _status = o._status;
+      _status = _converted_status(o._status, *this);
       o._status.set_have_moved_from(true);
     }
 
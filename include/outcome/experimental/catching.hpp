@@ -0,0 +1,67 @@
+/* Calling of throwing callables at a boundary returning status code outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#ifndef OUTCOME_EXPERIMENTAL_CATCHING_HPP
+#define OUTCOME_EXPERIMENTAL_CATCHING_HPP
+
+#include "../catching.hpp"
+#include "status_outcome.hpp"
+
+#ifdef __cpp_exceptions
+#if !OUTCOME_USE_SYSTEM_STATUS_CODE && __has_include("status-code/include/status-code/system_code_from_exception.hpp")
+#include "status-code/include/status-code/system_code_from_exception.hpp"
+#else
+#include <status-code/system_code_from_exception.hpp>
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace trait
+{
+  template <class DomainType> struct exception_to_error<SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>>
+  {
+    static constexpr bool value = true;
+    // Returns the error matching the exception being handled, or that for unmatched exceptions
+    static SYSTEM_ERROR2_NAMESPACE::system_code make(bool &matched) noexcept
+    {
+      SYSTEM_ERROR2_NAMESPACE::system_code sc = SYSTEM_ERROR2_NAMESPACE::system_code_from_exception(std::current_exception(), {});
+      matched = sc.failure();
+      if(!matched)
+      {
+        return SYSTEM_ERROR2_NAMESPACE::generic_code(SYSTEM_ERROR2_NAMESPACE::errc::resource_unavailable_try_again);
+      }
+      return sc;
+    }
+  };
+  template <class DomainType>
+  struct exception_to_error<SYSTEM_ERROR2_NAMESPACE::errored_status_code<DomainType>> : exception_to_error<SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>>
+  {
+  };
+}  // namespace trait
+
+OUTCOME_V2_NAMESPACE_END
+#endif
+
+#endif
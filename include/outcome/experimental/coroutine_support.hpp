@@ -44,6 +44,12 @@ Distributed under the Boost Software License, Version 1.0.
   }                                                                                                                                                                                                                                                                                                                            \
   OUTCOME_V2_NAMESPACE_END
 
+#if !OUTCOME_USE_SYSTEM_STATUS_CODE && __has_include("status-code/include/status-code/errored_status_code.hpp")
+#include "status-code/include/status-code/errored_status_code.hpp"
+#else
+#include <status-code/errored_status_code.hpp>
+#endif
+
 #ifdef __cpp_exceptions
 #if !OUTCOME_USE_SYSTEM_STATUS_CODE && __has_include("status-code/include/status-code/system_code_from_exception.hpp")
 #include "status-code/include/status-code/system_code_from_exception.hpp"
@@ -67,6 +73,24 @@ OUTCOME_V2_NAMESPACE_END
 
 #include "../detail/coroutine_support.ipp"
 
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace awaitables
+{
+  namespace detail
+  {
+    template <class DomainType> struct cancellation_traits<SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>>
+    {
+      static constexpr bool value = true;
+      static SYSTEM_ERROR2_NAMESPACE::generic_code make() noexcept { return SYSTEM_ERROR2_NAMESPACE::errc::operation_canceled; }
+    };
+    template <class DomainType>
+    struct cancellation_traits<SYSTEM_ERROR2_NAMESPACE::errored_status_code<DomainType>> : cancellation_traits<SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>>
+    {
+    };
+  }  // namespace detail
+}  // namespace awaitables
+OUTCOME_V2_NAMESPACE_END
+
 #undef OUTCOME_COROUTINE_SUPPORT_NAMESPACE_BEGIN
 #undef OUTCOME_COROUTINE_SUPPORT_NAMESPACE_EXPORT_BEGIN
 #undef OUTCOME_COROUTINE_SUPPORT_NAMESPACE_END
@@ -0,0 +1,199 @@
+/* Wrappers of POSIX syscalls returning status_result
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXPERIMENTAL_POSIX_HPP
+#define OUTCOME_EXPERIMENTAL_POSIX_HPP
+
+#include "status_result.hpp"
+
+#ifdef SYSTEM_ERROR2_NOT_POSIX
+#error "outcome/experimental/posix.hpp requires a POSIX platform"
+#endif
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace experimental
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  namespace posix
+  {
+    namespace detail
+    {
+      // Retries a syscall returning -1 for as long as it fails with EINTR
+      template <class F> inline auto retry_on_eintr(F &&f) noexcept -> decltype(f())
+      {
+        for(;;)
+        {
+          auto ret = f();
+          if(ret != -1 || errno != EINTR)
+          {
+            return ret;
+          }
+        }
+      }
+      // Converts a syscall's return into a status_result, fetching errno if it failed
+      template <class T, class U> inline status_result<T> to_result(U ret) noexcept
+      {
+        if(ret == -1)
+        {
+          return posix_code::current();
+        }
+        return static_cast<T>(ret);
+      }
+      inline status_result<void> to_result(int ret) noexcept
+      {
+        if(ret == -1)
+        {
+          return posix_code::current();
+        }
+        return success();
+      }
+    }  // namespace detail
+
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<int> open(const char *path, int flags, mode_t mode = 0) noexcept
+    {
+      return detail::to_result<int>(detail::retry_on_eintr([&] { return ::open(path, flags, mode); }));  // NOLINT
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<int> openat(int dirfd, const char *path, int flags, mode_t mode = 0) noexcept
+    {
+      return detail::to_result<int>(detail::retry_on_eintr([&] { return ::openat(dirfd, path, flags, mode); }));  // NOLINT
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    inline status_result<void> close(int fd) noexcept
+    {
+      // Never retried, as upon EINTR most platforms have already released the descriptor
+      return detail::to_result(::close(fd));
+    }
+
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> read(int fd, void *buf, size_t count) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::read(fd, buf, count); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> write(int fd, const void *buf, size_t count) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::write(fd, buf, count); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> pread(int fd, void *buf, size_t count, off_t offset) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::pread(fd, buf, count, offset); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> pwrite(int fd, const void *buf, size_t count, off_t offset) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::pwrite(fd, buf, count, offset); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> readv(int fd, const struct iovec *iov, int iovcnt) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::readv(fd, iov, iovcnt); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> writev(int fd, const struct iovec *iov, int iovcnt) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::writev(fd, iov, iovcnt); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> preadv(int fd, const struct iovec *iov, int iovcnt, off_t offset) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::preadv(fd, iov, iovcnt, offset); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<size_t> pwritev(int fd, const struct iovec *iov, int iovcnt, off_t offset) noexcept
+    {
+      return detail::to_result<size_t>(detail::retry_on_eintr([&] { return ::pwritev(fd, iov, iovcnt, offset); }));
+    }
+
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    inline status_result<void> fsync(int fd) noexcept
+    {
+      return detail::to_result(detail::retry_on_eintr([&] { return ::fsync(fd); }));
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    inline status_result<void> ftruncate(int fd, off_t length) noexcept
+    {
+      return detail::to_result(detail::retry_on_eintr([&] { return ::ftruncate(fd, length); }));
+    }
+
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    OUTCOME_NODISCARD inline status_result<void *> mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept
+    {
+      void *ret = ::mmap(addr, length, prot, flags, fd, offset);
+      if(ret == MAP_FAILED)  // NOLINT
+      {
+        return posix_code::current();
+      }
+      return ret;
+    }
+    /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+    inline status_result<void> munmap(void *addr, size_t length) noexcept { return detail::to_result(::munmap(addr, length)); }
+  }  // namespace posix
+}  // namespace experimental
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
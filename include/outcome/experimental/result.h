@@ -39,6 +39,32 @@ Distributed under the Boost Software License, Version 1.0.
 #endif
 #endif
 
+/* Weak variables are defined with OUTCOME_C_WEAK_VARIABLE. MSVC has no weak declarations, so
+there the linker instead aliases a missing definition to one whose value is null, which is why
+presence must be tested with OUTCOME_C_WEAK_VARIABLE_PRESENT().
+*/
+#ifndef OUTCOME_C_WEAK_VARIABLE
+#ifdef _MSC_VER
+#define OUTCOME_C_WEAK_VARIABLE __declspec(selectany)
+#else
+#define OUTCOME_C_WEAK_VARIABLE __attribute__((weak))
+#endif
+#endif
+#ifndef OUTCOME_C_WEAK_VARIABLE_PRESENT
+#ifdef _MSC_VER
+#define OUTCOME_C_WEAK_VARIABLE_PRESENT(x) ((x) != NULL)
+#else
+#define OUTCOME_C_WEAK_VARIABLE_PRESENT(x) (&(x) != NULL)
+#endif
+#endif
+#ifdef _MSC_VER
+#ifdef _M_IX86
+#define OUTCOME_C_MSVC_SYMBOL(x) "_" x
+#else
+#define OUTCOME_C_MSVC_SYMBOL(x) x
+#endif
+#endif
+
 #ifndef OUTCOME_C_MSVC_FORCE_EMIT
 #ifdef _MSC_VER
 #ifdef __cplusplus
@@ -121,6 +147,16 @@ extern "C"
 
 #define CXX_STATUS_CODE(ident) struct cxx_status_code_##ident
 
+#ifdef _MSC_VER
+  extern const void *const outcome_status_code_posix_domain;
+  extern const void *const outcome_status_code_system_domain;
+  extern __declspec(selectany) const void *const outcome_status_code_domain_missing = NULL;
+#pragma comment(linker, "/alternatename:" OUTCOME_C_MSVC_SYMBOL("outcome_status_code_posix_domain") "=" OUTCOME_C_MSVC_SYMBOL("outcome_status_code_domain_missing"))
+#pragma comment(linker, "/alternatename:" OUTCOME_C_MSVC_SYMBOL("outcome_status_code_system_domain") "=" OUTCOME_C_MSVC_SYMBOL("outcome_status_code_domain_missing"))
+#else
+  extern OUTCOME_C_WEAK_VARIABLE const void *const outcome_status_code_posix_domain;
+  extern OUTCOME_C_WEAK_VARIABLE const void *const outcome_status_code_system_domain;
+#endif
   extern OUTCOME_C_WEAK void outcome_make_result_status_code_failure_posix(void *out, size_t bytes, size_t offset, int errcode);
   extern OUTCOME_C_WEAK void outcome_make_result_status_code_failure_system(void *out, size_t bytes, size_t offset, intptr_t errcode);
   extern OUTCOME_C_WEAK int outcome_status_code_equal(const void *a, const void *b);
@@ -171,6 +207,44 @@ extern "C"
 #define CXX_DECLARE_RESULT_STATUS_CODE_CXX(ident, R, S)
 #endif
 
+/* On little endian architectures, a C++ status code's value is erased by integer conversion,
+so C can construct failures inline without calling into C++. Elsewhere C++ must do it.
+*/
+#ifndef OUTCOME_C_INLINE_STATUS_CODE_FAILURE
+#if defined(_WIN32) || defined(__APPLE__) || __LITTLE_ENDIAN__ || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define OUTCOME_C_INLINE_STATUS_CODE_FAILURE 1
+#else
+#define OUTCOME_C_INLINE_STATUS_CODE_FAILURE 0
+#endif
+#endif
+
+#if OUTCOME_C_INLINE_STATUS_CODE_FAILURE
+#ifdef _WIN32
+#define OUTCOME_C_SYSTEM_CODE_VALUE(errcode) ((intptr_t) (uint32_t) (errcode)) /* DWORD */
+#define OUTCOME_C_SYSTEM_CODE_FLAGS 2U                                         /* have_error */
+#else
+#define OUTCOME_C_SYSTEM_CODE_VALUE(errcode) ((intptr_t) (errcode))
+#define OUTCOME_C_SYSTEM_CODE_FLAGS (2U | (1U << 4U)) /* have_error | have_error_is_errno */
+#endif
+#define OUTCOME_C_SET_RESULT_STATUS_CODE_FAILURE_POSIX(ident, ret, errcode)                                                                                    \
+  assert(OUTCOME_C_WEAK_VARIABLE_PRESENT(outcome_status_code_posix_domain)); /* If this fails, you need to compile this file at least once in C++. */          \
+  (ret).flags = 2U | (1U << 4U) /* have_error | have_error_is_errno */;                                                                                        \
+  (ret).error.domain = (void *) outcome_status_code_posix_domain;                                                                                              \
+  (ret).error.value = (errcode)
+#define OUTCOME_C_SET_RESULT_STATUS_CODE_FAILURE_SYSTEM(ident, ret, errcode)                                                                                   \
+  assert(OUTCOME_C_WEAK_VARIABLE_PRESENT(outcome_status_code_system_domain)); /* If this fails, you need to compile this file at least once in C++. */         \
+  (ret).flags = OUTCOME_C_SYSTEM_CODE_FLAGS;                                                                                                                   \
+  (ret).error.domain = (void *) outcome_status_code_system_domain;                                                                                             \
+  (ret).error.value = OUTCOME_C_SYSTEM_CODE_VALUE(errcode)
+#else
+#define OUTCOME_C_SET_RESULT_STATUS_CODE_FAILURE_POSIX(ident, ret, errcode)                                                                                    \
+  assert(outcome_make_result_status_code_failure_posix != NULL); /* If this fails, you need to compile this file at least once in C++. */                      \
+  outcome_make_result_status_code_failure_posix((void *) &(ret), sizeof(ret), offsetof(struct cxx_result_status_code_##ident, flags), errcode)
+#define OUTCOME_C_SET_RESULT_STATUS_CODE_FAILURE_SYSTEM(ident, ret, errcode)                                                                                   \
+  assert(outcome_make_result_status_code_failure_system != NULL); /* If this fails, you need to compile this file at least once in C++. */                     \
+  outcome_make_result_status_code_failure_system((void *) &(ret), sizeof(ret), offsetof(struct cxx_result_status_code_##ident, flags), errcode)
+#endif
+
 #define CXX_DECLARE_RESULT_STATUS_CODE(ident, R, S)                                                                                                            \
   struct cxx_result_status_code_##ident                                                                                                                        \
   {                                                                                                                                                            \
@@ -185,22 +259,18 @@ extern "C"
     ret.flags = 1 /* have_value */;                                                                                                                            \
     return ret;                                                                                                                                                \
   }                                                                                                                                                            \
-  OUTCOME_C_NODISCARD_EXTERN_C OUTCOME_C_WEAK struct cxx_result_status_code_##ident outcome_make_result_##ident##_failure_posix(int errcode)                   \
+  OUTCOME_C_NODISCARD static OUTCOME_C_INLINE struct cxx_result_status_code_##ident outcome_make_result_##ident##_failure_posix(int errcode)                   \
   {                                                                                                                                                            \
     struct cxx_result_status_code_##ident ret;                                                                                                                 \
-    assert(outcome_make_result_status_code_failure_posix!=NULL); /* If this fails, you need to compile this file at least once in C++. */                            \
-    outcome_make_result_status_code_failure_posix((void *) &ret, sizeof(ret), offsetof(struct cxx_result_status_code_##ident, flags), errcode);                \
+    OUTCOME_C_SET_RESULT_STATUS_CODE_FAILURE_POSIX(ident, ret, errcode);                                                                                       \
     return ret;                                                                                                                                                \
   }                                                                                                                                                            \
-  OUTCOME_C_MSVC_FORCE_EMIT(outcome_make_result_##ident##_failure_posix)                                                                                       \
-  OUTCOME_C_NODISCARD_EXTERN_C OUTCOME_C_WEAK struct cxx_result_status_code_##ident outcome_make_result_##ident##_failure_system(intptr_t errcode)             \
+  OUTCOME_C_NODISCARD static OUTCOME_C_INLINE struct cxx_result_status_code_##ident outcome_make_result_##ident##_failure_system(intptr_t errcode)             \
   {                                                                                                                                                            \
     struct cxx_result_status_code_##ident ret;                                                                                                                 \
-    assert(outcome_make_result_status_code_failure_system!=NULL); /* If this fails, you need to compile this file at least once in C++. */                           \
-    outcome_make_result_status_code_failure_system((void *) &ret, sizeof(ret), offsetof(struct cxx_result_status_code_##ident, flags), errcode);               \
+    OUTCOME_C_SET_RESULT_STATUS_CODE_FAILURE_SYSTEM(ident, ret, errcode);                                                                                      \
     return ret;                                                                                                                                                \
   }                                                                                                                                                            \
-  OUTCOME_C_MSVC_FORCE_EMIT(outcome_make_result_##ident##_failure_system)                                                                                      \
   CXX_DECLARE_RESULT_STATUS_CODE_CXX(ident, R, S)
 
 #define CXX_RESULT_STATUS_CODE(ident) struct cxx_result_status_code_##ident
@@ -237,6 +307,7 @@ extern "C"
   OUTCOME_TRY_LIKELY_IF(CXX_RESULT_HAS_VALUE(unique));                                                                                                         \
   else                                                                                                                                                         \
   {                                                                                                                                                            \
+    cleanup;                                                                                                                                                   \
     retstmt;                                                                                                                                                   \
   }
 #define CXX_RESULT_SYSTEM_TRY_IMPLA(unique, retstmt, cleanup, var, ...)                                                                                        \
@@ -269,6 +340,33 @@ extern "C"
 
 #define CXX_RESULT_SYSTEM_TRY(...) OUTCOME_TRY_CALL_OVERLOAD(CXX_RESULT_SYSTEM_TRY_INVOKE_TRY, __VA_ARGS__)
 
+/* Rather than returning immediately, sets the error state of retvar and jumps to label upon
+failure. This lets a function acquiring several resources release them via a single chain
+of cleanup labels in reverse order of acquisition, rather than repeating the cleanup at
+each TRY. As the TRY is scoped, it never jumps over the initialisation of a variable.
+*/
+#define CXX_RESULT_SYSTEM_TRY_GOTO_IMPL(unique, assignment, retvar, label, ...)                                                                                \
+  {                                                                                                                                                            \
+    OUTCOME_TRYV2_UNIQUE_STORAGE(unique, deduce, __VA_ARGS__);                                                                                                 \
+    OUTCOME_TRY_LIKELY_IF(CXX_RESULT_HAS_VALUE(unique))                                                                                                        \
+    {                                                                                                                                                          \
+      assignment;                                                                                                                                              \
+    }                                                                                                                                                          \
+    else                                                                                                                                                       \
+    {                                                                                                                                                          \
+      (retvar).flags = (unique).flags;                                                                                                                         \
+      (retvar).error = (unique).error;                                                                                                                         \
+      goto label;                                                                                                                                              \
+    }                                                                                                                                                          \
+  }
+#define CXX_RESULT_SYSTEM_TRY_GOTO_IMPLV(unique, retvar, label, ...) CXX_RESULT_SYSTEM_TRY_GOTO_IMPL(unique, (void) 0, retvar, label, __VA_ARGS__)
+#define CXX_RESULT_SYSTEM_TRY_GOTO_IMPLA(unique, var, retvar, label, ...) CXX_RESULT_SYSTEM_TRY_GOTO_IMPL(unique, (var) = (unique).value, retvar, label, __VA_ARGS__)
+
+#define CXX_RESULT_SYSTEM_TRY_GOTO_INVOKE_TRY4(a, b, c, d) CXX_RESULT_SYSTEM_TRY_GOTO_IMPLA(OUTCOME_TRY_UNIQUE_NAME, a, b, c, d)
+#define CXX_RESULT_SYSTEM_TRY_GOTO_INVOKE_TRY3(a, b, c) CXX_RESULT_SYSTEM_TRY_GOTO_IMPLV(OUTCOME_TRY_UNIQUE_NAME, a, b, c)
+
+#define CXX_RESULT_SYSTEM_TRY_GOTO(...) OUTCOME_TRY_CALL_OVERLOAD(CXX_RESULT_SYSTEM_TRY_GOTO_INVOKE_TRY, __VA_ARGS__)
+
 #define CXX_MAKE_RESULT_SYSTEM_FROM_ENUM(ident, enum_name, ...) outcome_make_result_##ident##_failure_system_enum_##enum_name(__VA_ARGS__)
 #ifndef __cplusplus
 // Declares the function in C, needs to occur at least once in a C++ source file to get implemented
@@ -282,6 +380,7 @@ extern "C"
 #include "status-code/include/status-code/system_code.hpp"
 #include "status_result.hpp"
 
+#include "../detail/message_cache.hpp"
 
 #include "status-code/include/status-code/posix_code.hpp"
 #ifdef _WIN32
@@ -297,6 +396,14 @@ extern "C"
 #endif
 
 // You need to include this C header in at least one C++ source file to have these C helper functions be implemented
+extern "C" OUTCOME_C_WEAK_VARIABLE const void *const outcome_status_code_posix_domain = &OUTCOME_V2_NAMESPACE::experimental::posix_code::domain_type::get();
+extern "C" OUTCOME_C_WEAK_VARIABLE const void *const outcome_status_code_system_domain =
+#ifdef _WIN32
+&OUTCOME_V2_NAMESPACE::experimental::win32_code::domain_type::get();
+#else
+&OUTCOME_V2_NAMESPACE::experimental::posix_code::domain_type::get();
+#endif
+
 extern "C" OUTCOME_C_WEAK void outcome_make_result_status_code_failure_posix(void *out, size_t bytes, size_t offset, int errcode)
 {
   using value_type = OUTCOME_V2_NAMESPACE::experimental::posix_code::value_type;
@@ -374,10 +481,40 @@ extern "C" OUTCOME_C_WEAK int outcome_status_code_equal_generic(const void *_a,
 }
 OUTCOME_C_MSVC_FORCE_EMIT(outcome_status_code_equal_generic)
 
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace experimental
+{
+  namespace detail
+  {
+    struct status_code_messages;
+    // Only domains whose messages depend solely on the value can be cached
+    inline bool status_code_message_is_cacheable(const SYSTEM_ERROR2_NAMESPACE::system_code &v) noexcept
+    {
+      return !v.empty() && (v.domain() == SYSTEM_ERROR2_NAMESPACE::generic_code_domain || v.domain() == SYSTEM_ERROR2_NAMESPACE::posix_code_domain
+#ifdef _WIN32
+                            || v.domain() == SYSTEM_ERROR2_NAMESPACE::win32_code_domain
+#endif
+                           );
+    }
+  }  // namespace detail
+}  // namespace experimental
+OUTCOME_V2_NAMESPACE_END
+
 extern "C" OUTCOME_C_WEAK const char *outcome_status_code_message(const void *_a)
 {
   static thread_local SYSTEM_ERROR2_NAMESPACE::system_code::string_ref msg((const char *) nullptr, 0);
   const auto *a = (const SYSTEM_ERROR2_NAMESPACE::system_code *) _a;
+  if(OUTCOME_V2_NAMESPACE::experimental::detail::status_code_message_is_cacheable(*a))
+  {
+    return OUTCOME_V2_NAMESPACE::detail::message_cache<OUTCOME_V2_NAMESPACE::experimental::detail::status_code_messages>::get()
+    .lookup(a->domain().id(), a->value(),
+            [&]
+            {
+              auto m = a->message();
+              return std::string(m.data(), m.size());
+            })
+    .c_str();
+  }
   msg = a->message();
   return msg.c_str();
 }
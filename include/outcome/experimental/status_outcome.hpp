@@ -32,7 +32,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 // Boost.Outcome #include "boost/exception_ptr.hpp"
 
-SYSTEM_ERROR2_NAMESPACE_BEGIN
+OUTCOME_V2_CXX_MODULE_EXPORT SYSTEM_ERROR2_NAMESPACE_BEGIN
 template <class DomainType> inline std::exception_ptr basic_outcome_failure_exception_from_error(const status_code<DomainType> &sc)
 {
   (void) sc;
@@ -103,6 +103,91 @@ namespace detail
   {
     state._status.set_have_error_is_errno(true);
   }
+  template <class State, class ErasedType>
+  constexpr inline void _set_error_is_errno(State &state, const SYSTEM_ERROR2_NAMESPACE::status_code<SYSTEM_ERROR2_NAMESPACE::detail::erased<ErasedType>> &error)
+  {
+    // Erased codes are only errno if they were erased from a code whose value is errno
+    if(!error.empty() && (error.domain() == SYSTEM_ERROR2_NAMESPACE::generic_code_domain
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+                          || error.domain() == SYSTEM_ERROR2_NAMESPACE::posix_code_domain
+#endif
+                          ))
+    {
+      state._status.set_have_error_is_errno(true);
+    }
+  }
+
+  // Customise _errno_value, only ever called if have_error_is_errno
+  template <class State, class DomainType>
+  constexpr inline int _errno_value(const State & /*unused*/, const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &error) noexcept
+  {
+    return static_cast<int>(error.value());
+  }
+  template <class State> constexpr inline int _errno_value(const State & /*unused*/, const SYSTEM_ERROR2_NAMESPACE::errc &error) noexcept
+  {
+    return static_cast<int>(error);
+  }
+
+  // Customise _error_compare. Status codes compare semantically, and codes of the generic and posix domains
+  // are semantically equal exactly when their errno values are, so when both are errno the virtual
+  // equivalence test can be skipped.
+  template <class T> using _is_errno_capable_value = std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value>;
+  template <bool Equal, class A, class B>
+  constexpr inline bool _status_code_compare(const A &a, status_bitfield_type as, const B &b, status_bitfield_type bs, std::true_type /*unused*/)
+  {
+    if(as.have_error_is_errno() && bs.have_error_is_errno())
+    {
+      return (static_cast<int>(a.value()) == static_cast<int>(b.value())) == Equal;
+    }
+    return _error_comparer<Equal>::compare(a, b);
+  }
+  template <bool Equal, class A, class B>
+  constexpr inline bool _status_code_compare(const A &a, status_bitfield_type /*unused*/, const B &b, status_bitfield_type /*unused*/, std::false_type /*unused*/)
+  {
+    return _error_comparer<Equal>::compare(a, b);
+  }
+  template <bool Equal, class A, class B> constexpr inline bool _status_code_compare(const A &a, status_bitfield_type as, const B &b, status_bitfield_type bs)
+  {
+    return _status_code_compare<Equal>(
+    a, as, b, bs,
+    std::integral_constant<bool, _is_errno_capable_value<typename A::value_type>::value && _is_errno_capable_value<typename B::value_type>::value>());
+  }
+  template <bool Equal, class D1, class D2>
+  constexpr inline bool _error_compare(const SYSTEM_ERROR2_NAMESPACE::status_code<D1> &a, status_bitfield_type as, const SYSTEM_ERROR2_NAMESPACE::status_code<D2> &b,
+                                       status_bitfield_type bs)
+  {
+    return _status_code_compare<Equal>(a, as, b, bs);
+  }
+  template <bool Equal, class D1, class D2>
+  constexpr inline bool _error_compare(const SYSTEM_ERROR2_NAMESPACE::errored_status_code<D1> &a, status_bitfield_type as,
+                                       const SYSTEM_ERROR2_NAMESPACE::errored_status_code<D2> &b, status_bitfield_type bs)
+  {
+    return _status_code_compare<Equal>(a, as, b, bs);
+  }
+  template <bool Equal, class D1, class D2>
+  constexpr inline bool _error_compare(const SYSTEM_ERROR2_NAMESPACE::status_code<D1> &a, status_bitfield_type as,
+                                       const SYSTEM_ERROR2_NAMESPACE::errored_status_code<D2> &b, status_bitfield_type bs)
+  {
+    return _status_code_compare<Equal>(a, as, b, bs);
+  }
+  template <bool Equal, class D1, class D2>
+  constexpr inline bool _error_compare(const SYSTEM_ERROR2_NAMESPACE::errored_status_code<D1> &a, status_bitfield_type as,
+                                       const SYSTEM_ERROR2_NAMESPACE::status_code<D2> &b, status_bitfield_type bs)
+  {
+    return _status_code_compare<Equal>(a, as, b, bs);
+  }
+  template <bool Equal, class DomainType>
+  constexpr inline bool _error_compare(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &a, status_bitfield_type as, const SYSTEM_ERROR2_NAMESPACE::errc &b,
+                                       status_bitfield_type /*unused*/)
+  {
+    return _status_code_compare<Equal>(a, as, SYSTEM_ERROR2_NAMESPACE::generic_code(b), status_bitfield_type(status::have_error_error_is_errno));
+  }
+  template <bool Equal, class DomainType>
+  constexpr inline bool _error_compare(const SYSTEM_ERROR2_NAMESPACE::errored_status_code<DomainType> &a, status_bitfield_type as,
+                                       const SYSTEM_ERROR2_NAMESPACE::errc &b, status_bitfield_type /*unused*/)
+  {
+    return _status_code_compare<Equal>(a, as, SYSTEM_ERROR2_NAMESPACE::generic_code(b), status_bitfield_type(status::have_error_error_is_errno));
+  }
 
 }  // namespace detail
 
@@ -0,0 +1,179 @@
+/* std::hash specialisations for result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_HASH_SUPPORT_HPP
+#define OUTCOME_HASH_SUPPORT_HPP
+
+#include "outcome.hpp"
+
+// std::hash is also declared by <system_error>, and <functional> would add half again to the cost of outcome.hpp
+#include <system_error>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // std::hash<T> is default constructible only if enabled for T
+  template <class T> struct is_hashable : std::is_default_constructible<std::hash<T>>
+  {
+  };
+  template <> struct is_hashable<void> : std::true_type
+  {
+  };
+
+  // Which alternative was hashed goes into the seed, so a value and an error which happen to hash the same don't collide
+  enum hash_seed : size_t
+  {
+    hash_seed_value = 1,
+    hash_seed_error = 2,
+    hash_seed_exception = 4
+  };
+
+  constexpr inline size_t hash_combine(size_t seed, size_t v) noexcept { return seed ^ (v + static_cast<size_t>(0x9E3779B97F4A7C15ULL) + (seed << 6U) + (seed >> 2U)); }
+
+  template <class T> inline size_t hash_of(const T &v) { return std::hash<T>()(v); }
+
+  template <class T, class O> inline size_t hash_value_of(std::false_type /*is void*/, const O &o) { return hash_of<T>(o.assume_value()); }
+  template <class T, class O> inline size_t hash_value_of(std::true_type /*is void*/, const O & /*unused*/) noexcept { return 0; }
+  template <class T, class O> inline size_t hash_error_of(std::false_type /*is void*/, const O &o) { return hash_of<T>(o.assume_error()); }
+  template <class T, class O> inline size_t hash_error_of(std::true_type /*is void*/, const O & /*unused*/) noexcept { return 0; }
+  // Exceptions without a hash, such as std::exception_ptr on most standard libraries, all hash the same
+  template <class T> inline size_t hash_exception_of(std::true_type /*is hashable*/, const T &v) { return hash_of<T>(v); }
+  template <class T> inline size_t hash_exception_of(std::false_type /*is hashable*/, const T & /*unused*/) noexcept { return 0; }
+
+  template <class T, class Hash, bool Enabled> struct hash_if_enabled
+  {
+    size_t operator()(const T &v) const { return Hash()(v); }
+  };
+  template <class T, class Hash> struct hash_if_enabled<T, Hash, false>
+  {
+    hash_if_enabled() = delete;
+    hash_if_enabled(const hash_if_enabled &) = delete;
+    hash_if_enabled(hash_if_enabled &&) = delete;
+    hash_if_enabled &operator=(const hash_if_enabled &) = delete;
+    hash_if_enabled &operator=(hash_if_enabled &&) = delete;
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+struct result_hash
+{
+  using is_transparent = void;
+
+  OUTCOME_TEMPLATE(class R, class S, class NoValuePolicy)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_hashable<R>::value && detail::is_hashable<S>::value))
+  size_t operator()(const basic_result<R, S, NoValuePolicy> &r) const
+  {
+    if(r.has_value())
+    {
+      return detail::hash_combine(detail::hash_seed_value, detail::hash_value_of<R>(std::is_void<R>(), r));
+    }
+    if(r.has_error())
+    {
+      return detail::hash_combine(detail::hash_seed_error, detail::hash_error_of<S>(std::is_void<S>(), r));
+    }
+    return 0;
+  }
+  /* Outcomes with both an error and an exception compare equal to outcomes with just the
+  same error, so they hash by their error alone.
+  */
+  OUTCOME_TEMPLATE(class R, class S, class P, class NoValuePolicy)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_hashable<R>::value && detail::is_hashable<S>::value))
+  size_t operator()(const basic_outcome<R, S, P, NoValuePolicy> &o) const
+  {
+    if(o.has_value())
+    {
+      return detail::hash_combine(detail::hash_seed_value, detail::hash_value_of<R>(std::is_void<R>(), o));
+    }
+    if(o.has_error())
+    {
+      return detail::hash_combine(detail::hash_seed_error, detail::hash_error_of<S>(std::is_void<S>(), o));
+    }
+    if(o.has_exception())
+    {
+      return detail::hash_combine(detail::hash_seed_exception, detail::hash_exception_of(detail::is_hashable<P>(), o.assume_exception()));
+    }
+    return 0;
+  }
+
+  OUTCOME_TEMPLATE(class T)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_hashable<T>::value))
+  size_t operator()(const success_type<T> &v) const { return detail::hash_combine(detail::hash_seed_value, detail::hash_of<T>(v.value())); }
+  size_t operator()(const success_type<void> & /*unused*/) const noexcept { return detail::hash_combine(detail::hash_seed_value, 0); }
+
+  OUTCOME_TEMPLATE(class EC)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_hashable<EC>::value))
+  size_t operator()(const failure_type<EC, void> &v) const { return detail::hash_combine(detail::hash_seed_error, detail::hash_of<EC>(v.error())); }
+  template <class E> size_t operator()(const failure_type<void, E> &v) const
+  {
+    return detail::hash_combine(detail::hash_seed_exception, detail::hash_exception_of(detail::is_hashable<E>(), v.exception()));
+  }
+  OUTCOME_TEMPLATE(class EC, class E)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_hashable<EC>::value))
+  size_t operator()(const failure_type<EC, E> &v) const
+  {
+    if(v.has_error())
+    {
+      return detail::hash_combine(detail::hash_seed_error, detail::hash_of<EC>(v.error()));
+    }
+    if(v.has_exception())
+    {
+      return detail::hash_combine(detail::hash_seed_exception, detail::hash_exception_of(detail::is_hashable<E>(), v.exception()));
+    }
+    return 0;
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+// Specialisations cannot be exported, but are reachable from importers of the module anyway
+namespace std
+{
+  template <class R, class S, class NoValuePolicy>
+  struct hash<OUTCOME_V2_NAMESPACE::basic_result<R, S, NoValuePolicy>>
+      : OUTCOME_V2_NAMESPACE::detail::hash_if_enabled<OUTCOME_V2_NAMESPACE::basic_result<R, S, NoValuePolicy>, OUTCOME_V2_NAMESPACE::result_hash,
+                                                      OUTCOME_V2_NAMESPACE::detail::is_hashable<R>::value && OUTCOME_V2_NAMESPACE::detail::is_hashable<S>::value>
+  {
+  };
+  template <class R, class S, class P, class NoValuePolicy>
+  struct hash<OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, NoValuePolicy>>
+      : OUTCOME_V2_NAMESPACE::detail::hash_if_enabled<OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, NoValuePolicy>, OUTCOME_V2_NAMESPACE::result_hash,
+                                                      OUTCOME_V2_NAMESPACE::detail::is_hashable<R>::value && OUTCOME_V2_NAMESPACE::detail::is_hashable<S>::value>
+  {
+  };
+  template <class T>
+  struct hash<OUTCOME_V2_NAMESPACE::success_type<T>>
+      : OUTCOME_V2_NAMESPACE::detail::hash_if_enabled<OUTCOME_V2_NAMESPACE::success_type<T>, OUTCOME_V2_NAMESPACE::result_hash, OUTCOME_V2_NAMESPACE::detail::is_hashable<T>::value>
+  {
+  };
+  template <class EC, class E>
+  struct hash<OUTCOME_V2_NAMESPACE::failure_type<EC, E>>
+      : OUTCOME_V2_NAMESPACE::detail::hash_if_enabled<OUTCOME_V2_NAMESPACE::failure_type<EC, E>, OUTCOME_V2_NAMESPACE::result_hash, OUTCOME_V2_NAMESPACE::detail::is_hashable<EC>::value>
+  {
+  };
+}  // namespace std
+
+#endif
@@ -27,10 +27,12 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "outcome.hpp"
 
+#include "detail/message_cache.hpp"
+
 #include <iostream>
 #include <sstream>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
@@ -126,10 +128,17 @@ namespace detail
   }
   template <class T, class E> inline std::istream &operator>>(std::istream &s, value_storage_trivial<T, E> &v) { return value_storage_in(s, v); }
   template <class T, class E> inline std::istream &operator>>(std::istream &s, value_storage_nontrivial<T, E> &v) { return value_storage_in(s, v); }
+  struct std_error_code_messages;
+  // Looks up the message of an error code from this thread's cache
+  inline const std::string &cached_message(const std::error_code &ec)
+  {
+    return message_cache<std_error_code_messages>::get().lookup(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&ec.category())), ec.value(),
+                                                                 [&] { return ec.message(); });
+  }
   OUTCOME_TEMPLATE(class T)
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_constructible<std::error_code, T>::value))
-  inline std::string safe_message(T && /*unused*/) { return {}; }
-  inline std::string safe_message(const std::error_code &ec) { return " (" + ec.message() + ")"; }
+  inline std::ostream &safe_message(std::ostream &s, T && /*unused*/) { return s; }
+  inline std::ostream &safe_message(std::ostream &s, const std::error_code &ec) { return s << " (" << cached_message(ec) << ")"; }
 }  // namespace detail
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -172,7 +181,7 @@ template <class R, class S, class P> inline std::string print(const basic_result
   }
   if(v.has_error())
   {
-    s << v.error() << detail::safe_message(v.error());
+    detail::safe_message(s << v.error(), v.error());
   }
   return s.str();
 }
@@ -188,7 +197,7 @@ template <class S, class P> inline std::string print(const basic_result<void, S,
   }
   if(v.has_error())
   {
-    s << v.error() << detail::safe_message(v.error());
+    detail::safe_message(s << v.error(), v.error());
   }
   return s.str();
 }
@@ -0,0 +1,351 @@
+/* A result of a batch operation, whose items may partially fail
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_PARTIAL_RESULT_HPP
+#define OUTCOME_PARTIAL_RESULT_HPP
+
+#include "result.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class E> struct item_failure
+{
+  size_t index;
+  E error;
+};
+
+namespace detail
+{
+  // A vector of item failures which stores up to N of them without allocating
+  template <class E, size_t N> class partial_result_failures
+  {
+    static_assert(N > 0, "partial_result_failures needs space for at least one failure");
+    using _item = item_failure<E>;
+    using _allocator = std::allocator<_item>;
+
+    alignas(_item) unsigned char _inline[N * sizeof(_item)];
+    _item *_heap{nullptr};
+    size_t _size{0}, _capacity{N};
+
+    _item *_data() noexcept { return (_heap != nullptr) ? _heap : reinterpret_cast<_item *>(_inline); }
+    const _item *_data() const noexcept { return (_heap != nullptr) ? _heap : reinterpret_cast<const _item *>(_inline); }
+    void _destroy() noexcept
+    {
+      clear();
+      if(_heap != nullptr)
+      {
+        _allocator().deallocate(_heap, _capacity);
+        _heap = nullptr;
+        _capacity = N;
+      }
+    }
+    void _grow()
+    {
+      const size_t capacity = _capacity * 2;
+      _item *p = _allocator().allocate(capacity);
+      _item *old = _data();
+      size_t n = 0;
+#ifdef __cpp_exceptions
+      try
+#endif
+      {
+        for(; n < _size; n++)
+        {
+          new(p + n) _item(std::move_if_noexcept(old[n]));
+        }
+      }
+#ifdef __cpp_exceptions
+      catch(...)
+      {
+        while(n > 0)
+        {
+          p[--n].~_item();
+        }
+        _allocator().deallocate(p, capacity);
+        throw;
+      }
+#endif
+      const size_t size = _size;
+      _destroy();
+      _heap = p;
+      _size = size;
+      _capacity = capacity;
+    }
+
+    // Steals an allocation, else moves the inline failures
+    void _move_from(partial_result_failures &&o) noexcept(std::is_nothrow_move_constructible<E>::value)
+    {
+      if(o._heap != nullptr)
+      {
+        _heap = o._heap;
+        _size = o._size;
+        _capacity = o._capacity;
+        o._heap = nullptr;
+        o._size = 0;
+        o._capacity = N;
+        return;
+      }
+      _item *from = o._data(), *to = _data();
+      for(size_t n = 0; n < o._size; n++)
+      {
+        new(to + n) _item(static_cast<_item &&>(from[n]));
+        _size = n + 1;
+      }
+      o.clear();
+    }
+
+  public:
+    using value_type = _item;
+    using const_iterator = const _item *;
+
+    partial_result_failures() noexcept {}  // NOLINT
+    partial_result_failures(const partial_result_failures &o)
+        : partial_result_failures()
+    {
+      for(const auto &i : o)
+      {
+        emplace_back(i.index, i.error);
+      }
+    }
+    partial_result_failures(partial_result_failures &&o) noexcept(std::is_nothrow_move_constructible<E>::value)
+        : partial_result_failures()
+    {
+      _move_from(static_cast<partial_result_failures &&>(o));
+    }
+    partial_result_failures &operator=(const partial_result_failures &o)
+    {
+      if(this != &o)
+      {
+        clear();
+        for(const auto &i : o)
+        {
+          emplace_back(i.index, i.error);
+        }
+      }
+      return *this;
+    }
+    partial_result_failures &operator=(partial_result_failures &&o) noexcept(std::is_nothrow_move_constructible<E>::value)
+    {
+      if(this != &o)
+      {
+        _destroy();
+        _move_from(static_cast<partial_result_failures &&>(o));
+      }
+      return *this;
+    }
+    ~partial_result_failures() { _destroy(); }
+
+    template <class... Args> void emplace_back(size_t index, Args &&...args)
+    {
+      if(_size == _capacity)
+      {
+        _grow();
+      }
+      new(_data() + _size) _item{index, E(static_cast<Args &&>(args)...)};
+      _size++;
+    }
+    void clear() noexcept
+    {
+      _item *p = _data();
+      while(_size > 0)
+      {
+        p[--_size].~_item();
+      }
+    }
+
+    bool empty() const noexcept { return _size == 0; }
+    size_t size() const noexcept { return _size; }
+    size_t capacity() const noexcept { return _capacity; }
+    const _item *data() const noexcept { return _data(); }
+    const _item *begin() const noexcept { return _data(); }
+    const _item *end() const noexcept { return _data() + _size; }
+    const _item &operator[](size_t n) const noexcept
+    {
+      OUTCOME_ASSERT(n < _size);
+      return _data()[n];
+    }
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T, class E = std::error_code, size_t N = 4> class OUTCOME_NODISCARD partial_result
+{
+public:
+  using value_type = T;
+  using error_type = E;
+  using result_type = result<T, E>;
+  using item_failure_type = item_failure<E>;
+  using failures_type = detail::partial_result_failures<E, N>;
+  static constexpr size_t inline_failures = N;
+
+private:
+  result_type _result;
+  failures_type _failures;
+
+  template <class U>
+  static constexpr bool _is_own = std::is_same<partial_result, std::decay_t<U>>::value || detail::is_in_place_type_t<std::decay_t<U>>::value;
+
+public:
+  partial_result() = delete;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!_is_own<U> && std::is_convertible<U, result_type>::value))
+  partial_result(U &&v) noexcept(std::is_nothrow_constructible<result_type, U>::value)  // NOLINT
+      : _result(static_cast<U &&>(v))
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!_is_own<U> && !std::is_convertible<U, result_type>::value && std::is_constructible<result_type, U>::value))
+  explicit partial_result(U &&v) noexcept(std::is_nothrow_constructible<result_type, U>::value)
+      : _result(static_cast<U &&>(v))
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class Tag, class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<result_type, in_place_type_t<Tag>, Args...>::value))
+  explicit partial_result(in_place_type_t<Tag> _, Args &&...args) noexcept(std::is_nothrow_constructible<result_type, in_place_type_t<Tag>, Args...>::value)
+      : _result(_, static_cast<Args &&>(args)...)
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<result_type, U>::value))
+  partial_result(U &&v, failures_type failures) noexcept(std::is_nothrow_constructible<result_type, U>::value && std::is_nothrow_move_constructible<E>::value)
+      : _result(static_cast<U &&>(v))
+      , _failures(static_cast<failures_type &&>(failures))
+  {
+  }
+  partial_result(const partial_result &) = default;
+  partial_result(partial_result &&) = default;  // NOLINT
+  partial_result &operator=(const partial_result &) = default;
+  partial_result &operator=(partial_result &&) = default;  // NOLINT
+  ~partial_result() = default;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  bool has_value() const noexcept { return _result.has_value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  bool has_error() const noexcept { return _result.has_error(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  explicit operator bool() const noexcept { return _result.has_value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  bool has_failures() const noexcept { return !_failures.empty(); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  decltype(auto) assume_value() & noexcept { return _result.assume_value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  decltype(auto) assume_value() const & noexcept { return _result.assume_value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  decltype(auto) assume_value() && noexcept { return static_cast<result_type &&>(_result).assume_value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  decltype(auto) value() & { return _result.value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  decltype(auto) value() const & { return _result.value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  decltype(auto) value() && { return static_cast<result_type &&>(_result).value(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const E &assume_error() const noexcept { return _result.assume_error(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const E &error() const { return _result.error(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  auto as_failure() const & { return _result.as_failure(); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  auto as_failure() && { return static_cast<result_type &&>(_result).as_failure(); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const failures_type &failures() const & noexcept { return _failures; }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  failures_type &&failures() && noexcept { return static_cast<failures_type &&>(_failures); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class... Args> void add_failure(size_t index, Args &&...args) { _failures.emplace_back(index, static_cast<Args &&>(args)...); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  void clear_failures() noexcept { _failures.clear(); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const result_type &as_result() const & noexcept { return _result; }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  result_type &&as_result() && noexcept { return static_cast<result_type &&>(_result); }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
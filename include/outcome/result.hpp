@@ -27,24 +27,4 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "std_result.hpp"
 
-OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
-
-/*! AWAITING HUGO JSON CONVERSION TOOL 
-SIGNATURE NOT RECOGNISED
-*/
-template <class R, class S = std::error_code, class NoValuePolicy = policy::default_policy<R, S, void>>  //
-using result = std_result<R, S, NoValuePolicy>;
-
-/*! AWAITING HUGO JSON CONVERSION TOOL 
-type alias template <class R, class S = std::error_code> unchecked. Potential doc page: `unchecked<T, E = varies>`
-*/
-template <class R, class S = std::error_code> using unchecked = result<R, S, policy::all_narrow>;
-
-/*! AWAITING HUGO JSON CONVERSION TOOL 
-type alias template <class R, class S = std::error_code> checked. Potential doc page: `checked<T, E = varies>`
-*/
-template <class R, class S = std::error_code> using checked = result<R, S, policy::throw_bad_result_access<S, void>>;
-
-OUTCOME_V2_NAMESPACE_END
-
 #endif
@@ -0,0 +1,293 @@
+/* A memoising cache of results
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_RESULT_CACHE_HPP
+#define OUTCOME_RESULT_CACHE_HPP
+
+#include "result.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Key, class T, class E = std::error_code, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>> class result_cache
+{
+public:
+  using key_type = Key;
+  using result_type = result<T, E>;
+  using clock_type = std::chrono::steady_clock;
+  using duration = typename clock_type::duration;
+
+  struct statistics
+  {
+    uint64_t hits{0};       // lookups answered from the cache
+    uint64_t misses{0};     // lookups which invoked the callable
+    uint64_t coalesced{0};  // lookups which waited for another's invocation
+    uint64_t evictions{0};  // entries removed to stay within capacity
+  };
+
+private:
+  // A computation in progress, shared with those waiting for it
+  struct _flight
+  {
+    std::shared_ptr<const result_type> result;
+    bool done{false};
+  };
+  struct _entry
+  {
+    std::shared_ptr<_flight> flight;  // set while being computed
+    std::shared_ptr<const result_type> result;
+    typename clock_type::time_point expires;
+    typename std::list<Key>::iterator lru;
+  };
+  struct _shard
+  {
+    std::mutex lock;
+    std::condition_variable ready;
+    std::unordered_map<Key, _entry, Hash, KeyEqual> entries;
+    std::list<Key> lru;  // most recently used first
+  };
+
+  std::unique_ptr<_shard[]> _shards;
+  size_t _shard_count, _shard_capacity;
+  duration _value_ttl, _error_ttl;
+  Hash _hash;
+  std::atomic<uint64_t> _hits{0}, _misses{0}, _coalesced{0}, _evictions{0};
+
+  _shard &_shard_for(const Key &key) const
+  {
+    // Mix the hash, so shards and the buckets within them use different bits
+    const uint64_t h = static_cast<uint64_t>(_hash(key)) * 0x9E3779B97F4A7C15ULL;
+    return _shards[static_cast<size_t>(h >> 32U) % _shard_count];
+  }
+  static void _erase(_shard &s, typename std::unordered_map<Key, _entry, Hash, KeyEqual>::iterator it)
+  {
+    s.lru.erase(it->second.lru);
+    s.entries.erase(it);
+  }
+  void _evict(_shard &s)
+  {
+    // Entries being computed have waiters, so they are skipped
+    for(auto i = s.lru.end(); s.entries.size() > _shard_capacity && i != s.lru.begin();)
+    {
+      --i;
+      auto it = s.entries.find(*i);
+      if(!it->second.flight)
+      {
+        i = s.lru.erase(i);
+        s.entries.erase(it);
+        _evictions.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+public:
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  result_cache(size_t capacity, duration value_ttl, duration error_ttl, size_t shards = 16)
+      : _shards(new _shard[(shards == 0) ? 1 : shards])
+      , _shard_count((shards == 0) ? 1 : shards)
+      , _shard_capacity((capacity + _shard_count - 1) / _shard_count)
+      , _value_ttl(value_ttl)
+      , _error_ttl(error_ttl)
+  {
+  }
+  result_cache(const result_cache &) = delete;
+  result_cache(result_cache &&) = delete;
+  result_cache &operator=(const result_cache &) = delete;
+  result_cache &operator=(result_cache &&) = delete;
+  ~result_cache() = default;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class F> result_type get_or_compute(const Key &key, F &&f)
+  {
+    _shard &s = _shard_for(key);
+    std::unique_lock<std::mutex> g(s.lock);
+    bool waited = false;
+    for(;;)
+    {
+      auto it = s.entries.find(key);
+      if(it == s.entries.end())
+      {
+        break;
+      }
+      if(!it->second.flight)
+      {
+        if(clock_type::now() < it->second.expires)
+        {
+          _hits.fetch_add(1, std::memory_order_relaxed);
+          s.lru.splice(s.lru.begin(), s.lru, it->second.lru);
+          std::shared_ptr<const result_type> r(it->second.result);
+          g.unlock();
+          return *r;
+        }
+        _erase(s, it);
+        break;
+      }
+      // Wait for the computation already in progress
+      if(!waited)
+      {
+        _coalesced.fetch_add(1, std::memory_order_relaxed);
+        waited = true;
+      }
+      std::shared_ptr<_flight> flight(it->second.flight);
+      s.ready.wait(g, [&] { return flight->done; });
+      if(flight->result)
+      {
+        std::shared_ptr<const result_type> r(flight->result);
+        g.unlock();
+        return *r;
+      }
+      // The computation threw, so try again
+    }
+    _misses.fetch_add(1, std::memory_order_relaxed);
+    auto flight = std::make_shared<_flight>();
+    {
+      auto it = s.entries.emplace(key, _entry{}).first;
+      it->second.flight = flight;
+      s.lru.push_front(key);
+      it->second.lru = s.lru.begin();
+      _evict(s);
+    }
+    g.unlock();
+    std::shared_ptr<const result_type> r;
+#ifdef __cpp_exceptions
+    try
+#endif
+    {
+      r = std::make_shared<const result_type>(static_cast<F &&>(f)());
+    }
+#ifdef __cpp_exceptions
+    catch(...)
+    {
+      g.lock();
+      auto it = s.entries.find(key);
+      if(it != s.entries.end() && it->second.flight == flight)
+      {
+        _erase(s, it);
+      }
+      flight->done = true;
+      g.unlock();
+      s.ready.notify_all();
+      throw;
+    }
+#endif
+    g.lock();
+    flight->result = r;
+    flight->done = true;
+    // If invalidated meanwhile, the waiters get the result but it is not cached
+    auto it = s.entries.find(key);
+    if(it != s.entries.end() && it->second.flight == flight)
+    {
+      const duration ttl = r->has_value() ? _value_ttl : _error_ttl;
+      if(ttl > duration::zero())
+      {
+        it->second.flight.reset();
+        it->second.result = r;
+        it->second.expires = clock_type::now() + ttl;
+      }
+      else
+      {
+        _erase(s, it);
+      }
+    }
+    g.unlock();
+    s.ready.notify_all();
+    return *r;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  bool invalidate(const Key &key)
+  {
+    _shard &s = _shard_for(key);
+    std::lock_guard<std::mutex> g(s.lock);
+    auto it = s.entries.find(key);
+    if(it == s.entries.end())
+    {
+      return false;
+    }
+    _erase(s, it);
+    return true;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  void clear()
+  {
+    for(size_t n = 0; n < _shard_count; n++)
+    {
+      std::lock_guard<std::mutex> g(_shards[n].lock);
+      _shards[n].entries.clear();
+      _shards[n].lru.clear();
+    }
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  size_t size() const
+  {
+    size_t ret = 0;
+    for(size_t n = 0; n < _shard_count; n++)
+    {
+      std::lock_guard<std::mutex> g(_shards[n].lock);
+      ret += _shards[n].entries.size();
+    }
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  statistics stats() const noexcept
+  {
+    statistics ret;
+    ret.hits = _hits.load(std::memory_order_relaxed);
+    ret.misses = _misses.load(std::memory_order_relaxed);
+    ret.coalesced = _coalesced.load(std::memory_order_relaxed);
+    ret.evictions = _evictions.load(std::memory_order_relaxed);
+    return ret;
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,132 @@
+/* Forward declarations of the result types
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_RESULT_FWD_HPP
+#define OUTCOME_RESULT_FWD_HPP
+
+/* This header declares, but does not define, `basic_result` and all of the
+type aliases in `result.hpp` and `std_result.hpp`, which is enough to declare
+functions taking or returning a `result`. It avoids parsing `value_storage.hpp`,
+`basic_result.hpp` and the policies, so headers which only declare functions
+are much cheaper to include. Include `result.hpp` wherever a `result` is
+constructed, observed or copied.
+*/
+
+#include "success_failure.hpp"
+#include "trait.hpp"
+
+#include "detail/trait_std_error_code.hpp"
+#include "detail/trait_std_exception.hpp"
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+template <class R, class S, class NoValuePolicy>  //
+class basic_result;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+namespace policy
+{
+  struct terminate;
+  struct all_narrow;
+  struct fail_to_compile_observers;
+  template <class T, class EC, class E> struct error_code_throw_as_system_error;
+  template <class T, class EC, class E> struct exception_ptr_rethrow;
+  template <class EC, class EP> struct throw_bad_result_access;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class T, class EC, class E>
+  using default_policy = std::conditional_t<  //
+  std::is_void<EC>::value && std::is_void<E>::value,
+  terminate,                                                                                                                     //
+  std::conditional_t<                                                                                                            //
+  trait::is_error_code_available<EC>::value, error_code_throw_as_system_error<T, EC, E>,                                         //
+  std::conditional_t<                                                                                                            //
+  trait::is_exception_ptr_available<EC>::value || trait::is_exception_ptr_available<E>::value, exception_ptr_rethrow<T, EC, E>,  //
+  fail_to_compile_observers                                                                                                      //
+  >>>;
+}  // namespace policy
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class R, class S = std::error_code, class NoValuePolicy = policy::default_policy<R, S, void>>  //
+using std_result = basic_result<R, S, NoValuePolicy>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <class R, class S = std::error_code> std_unchecked. Potential doc page: `std_unchecked<T, E = std::error_code>`
+*/
+template <class R, class S = std::error_code> using std_unchecked = std_result<R, S, policy::all_narrow>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <class R, class S = std::error_code> std_checked. Potential doc page: `std_checked<T, E = std::error_code>`
+*/
+template <class R, class S = std::error_code> using std_checked = std_result<R, S, policy::throw_bad_result_access<S, void>>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class R, class S = std::error_code, class NoValuePolicy = policy::default_policy<R, S, void>>  //
+using result = std_result<R, S, NoValuePolicy>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <class R, class S = std::error_code> unchecked. Potential doc page: `unchecked<T, E = varies>`
+*/
+template <class R, class S = std::error_code> using unchecked = result<R, S, policy::all_narrow>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <class R, class S = std::error_code> checked. Potential doc page: `checked<T, E = varies>`
+*/
+template <class R, class S = std::error_code> using checked = result<R, S, policy::throw_bad_result_access<S, void>>;
+
+OUTCOME_V2_NAMESPACE_END
+
+/* Explicit instantiation of `basic_result`, and of the base classes which
+implement its observers, as an explicit instantiation of a class does not
+instantiate the members of its bases. The full `result.hpp` must have been
+included before use.
+*/
+#define OUTCOME_V2_RESULT_INSTANTIATION(prefix, R, S, ...)                                                                                                    \
+  prefix template class OUTCOME_V2_NAMESPACE::detail::basic_result_storage<R, S, __VA_ARGS__>;                                                                \
+  prefix template class OUTCOME_V2_NAMESPACE::detail::basic_result_value_observers<OUTCOME_V2_NAMESPACE::detail::basic_result_storage<R, S, __VA_ARGS__>, R,  \
+                                                                                    __VA_ARGS__>;                                                             \
+  prefix template class OUTCOME_V2_NAMESPACE::detail::basic_result_error_observers<                                                                           \
+  OUTCOME_V2_NAMESPACE::detail::basic_result_value_observers<OUTCOME_V2_NAMESPACE::detail::basic_result_storage<R, S, __VA_ARGS__>, R, __VA_ARGS__>, S,       \
+  __VA_ARGS__>;                                                                                                                                               \
+  prefix template class OUTCOME_V2_NAMESPACE::detail::basic_result_final<R, S, __VA_ARGS__>;                                                                  \
+  prefix template class OUTCOME_V2_NAMESPACE::basic_result<R, S, __VA_ARGS__>
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_EXTERN_RESULT(R, S) OUTCOME_V2_RESULT_INSTANTIATION(extern, R, S, OUTCOME_V2_NAMESPACE::policy::default_policy<R, S, void>)
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_INSTANTIATE_RESULT(R, S) OUTCOME_V2_RESULT_INSTANTIATION(, R, S, OUTCOME_V2_NAMESPACE::policy::default_policy<R, S, void>)
+
+#endif
@@ -0,0 +1,301 @@
+/* Retrying of result returning callables which fail transiently
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_RETRY_HPP
+#define OUTCOME_RETRY_HPP
+
+#include "coroutine_support.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Errc = std::errc> struct transient_error
+{
+  // Comparison to an error condition enum uses equivalent(), so this works for any error code or status code comparable to Errc
+  template <class E> bool operator()(const E &e) const
+  {
+    return e == Errc::resource_unavailable_try_again || e == Errc::operation_would_block || e == Errc::interrupted || e == Errc::timed_out ||
+           e == Errc::device_or_resource_busy || e == Errc::no_buffer_space || e == Errc::connection_aborted || e == Errc::connection_refused ||
+           e == Errc::connection_reset || e == Errc::network_down || e == Errc::network_reset || e == Errc::network_unreachable ||
+           e == Errc::host_unreachable;
+  }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+class retry_budget
+{
+  // In thousandths of a retry
+  std::atomic<int64_t> _tokens;
+  int64_t _max, _per_success;
+
+public:
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  explicit retry_budget(uint32_t max_retries, double retries_per_success = 0.1) noexcept
+      : _tokens(static_cast<int64_t>(max_retries) * 1000)
+      , _max(static_cast<int64_t>(max_retries) * 1000)
+      , _per_success(static_cast<int64_t>(retries_per_success * 1000))
+  {
+  }
+  retry_budget(const retry_budget &) = delete;
+  retry_budget(retry_budget &&) = delete;
+  retry_budget &operator=(const retry_budget &) = delete;
+  retry_budget &operator=(retry_budget &&) = delete;
+  ~retry_budget() = default;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  bool try_withdraw() noexcept
+  {
+    int64_t t = _tokens.load(std::memory_order_relaxed);
+    do
+    {
+      if(t < 1000)
+      {
+        return false;
+      }
+    } while(!_tokens.compare_exchange_weak(t, t - 1000, std::memory_order_relaxed));
+    return true;
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  void deposit() noexcept
+  {
+    int64_t t = _tokens.load(std::memory_order_relaxed);
+    do
+    {
+      if(t >= _max)
+      {
+        return;
+      }
+    } while(!_tokens.compare_exchange_weak(t, (t + _per_success < _max) ? t + _per_success : _max, std::memory_order_relaxed));
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  double available() const noexcept { return static_cast<double>(_tokens.load(std::memory_order_relaxed)) / 1000; }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+class retry_counters
+{
+  friend struct retry_policy;
+  std::atomic<uint64_t> _calls{0}, _attempts{0}, _successes{0}, _permanent_failures{0}, _attempts_exhausted{0}, _deadlines_exceeded{0},
+  _budgets_exhausted{0}, _backoff_ns{0};
+
+public:
+  struct statistics
+  {
+    uint64_t calls{0};               // calls of retry()
+    uint64_t attempts{0};            // invocations of callables, so retries are attempts - calls
+    uint64_t successes{0};           // calls which returned success
+    uint64_t permanent_failures{0};  // calls which returned a failure not classified as transient
+    uint64_t attempts_exhausted{0};  // calls which returned a transient failure after the maximum attempts
+    uint64_t deadlines_exceeded{0};  // calls which returned a transient failure as backing off would pass the deadline
+    uint64_t budgets_exhausted{0};   // calls which returned a transient failure as the retry budget was empty
+    uint64_t backoff_ns{0};          // total time spent backing off
+  };
+
+  retry_counters() = default;
+  retry_counters(const retry_counters &) = delete;
+  retry_counters(retry_counters &&) = delete;
+  retry_counters &operator=(const retry_counters &) = delete;
+  retry_counters &operator=(retry_counters &&) = delete;
+  ~retry_counters() = default;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  statistics stats() const noexcept
+  {
+    statistics ret;
+    ret.calls = _calls.load(std::memory_order_relaxed);
+    ret.attempts = _attempts.load(std::memory_order_relaxed);
+    ret.successes = _successes.load(std::memory_order_relaxed);
+    ret.permanent_failures = _permanent_failures.load(std::memory_order_relaxed);
+    ret.attempts_exhausted = _attempts_exhausted.load(std::memory_order_relaxed);
+    ret.deadlines_exceeded = _deadlines_exceeded.load(std::memory_order_relaxed);
+    ret.budgets_exhausted = _budgets_exhausted.load(std::memory_order_relaxed);
+    ret.backoff_ns = _backoff_ns.load(std::memory_order_relaxed);
+    return ret;
+  }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+struct retry_policy
+{
+  using clock_type = std::chrono::steady_clock;
+  using duration = typename clock_type::duration;
+  using time_point = typename clock_type::time_point;
+
+  uint32_t max_attempts{3};  // including the first
+  duration initial_backoff{std::chrono::milliseconds(10)};
+  duration max_backoff{std::chrono::seconds(1)};
+  double backoff_multiplier{2};
+  double jitter{0.5};  // the fraction of each backoff which is randomly not waited
+  time_point deadline{time_point::max()};
+  retry_budget *budget{nullptr};
+  retry_counters *counters{nullptr};
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  duration backoff(uint32_t attempt) const noexcept
+  {
+    // splitmix64, which is plenty for spreading retries out
+    static thread_local uint64_t state = static_cast<uint64_t>(clock_type::now().time_since_epoch().count());
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31U;
+    double ret = static_cast<double>(initial_backoff.count());
+    for(uint32_t n = 1; n < attempt && ret < static_cast<double>(max_backoff.count()); n++)
+    {
+      ret *= backoff_multiplier;
+    }
+    if(ret > static_cast<double>(max_backoff.count()))
+    {
+      ret = static_cast<double>(max_backoff.count());
+    }
+    ret *= 1.0 - jitter * (static_cast<double>(z >> 11U) / 9007199254740992.0);
+    return duration(static_cast<typename duration::rep>(ret));
+  }
+
+  // Records the outcome of an attempt, returning whether to retry after backoff
+  template <class R, class Classifier> bool _on_attempt(const R &r, uint32_t attempt, Classifier &is_transient, duration &wait) const
+  {
+    if(counters != nullptr)
+    {
+      if(attempt == 1)
+      {
+        counters->_calls.fetch_add(1, std::memory_order_relaxed);
+      }
+      counters->_attempts.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::atomic<uint64_t> retry_counters::*finished = nullptr;
+    if(r.has_value())
+    {
+      if(budget != nullptr)
+      {
+        budget->deposit();
+      }
+      finished = &retry_counters::_successes;
+    }
+    else if(!r.has_error() || !is_transient(r.assume_error()))
+    {
+      finished = &retry_counters::_permanent_failures;
+    }
+    else if(attempt >= max_attempts)
+    {
+      finished = &retry_counters::_attempts_exhausted;
+    }
+    else
+    {
+      wait = backoff(attempt);
+      if(deadline != time_point::max() && clock_type::now() + wait >= deadline)
+      {
+        finished = &retry_counters::_deadlines_exceeded;
+      }
+      else if(budget != nullptr && !budget->try_withdraw())
+      {
+        finished = &retry_counters::_budgets_exhausted;
+      }
+    }
+    if(counters != nullptr)
+    {
+      if(finished != nullptr)
+      {
+        (counters->*finished).fetch_add(1, std::memory_order_relaxed);
+      }
+      else
+      {
+        counters->_backoff_ns.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count()), std::memory_order_relaxed);
+      }
+    }
+    return finished == nullptr;
+  }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class F, class Classifier = transient_error<>> auto retry(const retry_policy &policy, F &&f, Classifier is_transient = {}) -> decltype(f())
+{
+  retry_policy::duration backoff{};
+  for(uint32_t attempt = 1;; attempt++)
+  {
+    auto r = f();
+    if(!policy._on_attempt(r, attempt, is_transient, backoff))
+    {
+      return r;
+    }
+    std::this_thread::sleep_for(backoff);
+  }
+}
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+namespace detail
+{
+  template <class A> using retry_awaitable_result = std::decay_t<decltype(std::declval<A &>().await_resume())>;
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class F, class Sleep, class Classifier = transient_error<>>
+awaitables::lazy<detail::retry_awaitable_result<decltype(std::declval<F &>()())>> co_retry(retry_policy policy, F f, Sleep sleep, Classifier is_transient = {})
+{
+  retry_policy::duration backoff{};
+  for(uint32_t attempt = 1;; attempt++)
+  {
+    auto r = co_await f();
+    if(!policy._on_attempt(r, attempt, is_transient, backoff))
+    {
+      co_return r;
+    }
+    co_await sleep(backoff);
+  }
+}
+#endif
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
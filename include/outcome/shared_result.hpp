@@ -0,0 +1,349 @@
+/* A result whose value is shared between copies
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_SHARED_RESULT_HPP
+#define OUTCOME_SHARED_RESULT_HPP
+
+#include "result.hpp"
+
+#include <atomic>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // The value of a shared_result, and the count of shared_results referring to it
+  template <class T> struct shared_result_box
+  {
+    std::atomic<size_t> refs{1};
+    const T value;
+
+    template <class... Args>
+    explicit shared_result_box(Args &&...args)
+        : value(static_cast<Args &&>(args)...)
+    {
+    }
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T, class E = std::error_code> class OUTCOME_NODISCARD shared_result
+{
+  static_assert(!std::is_void<T>::value, "shared_result<void, E> would have no value to share, use result<void, E>");
+  static_assert(!std::is_reference<T>::value, "shared_result<T, E> cannot share a reference");
+
+  template <class U, class V> friend class shared_result;
+  using _box = detail::shared_result_box<T>;
+
+  union
+  {
+    _box *_value;
+    E _error;
+  };
+  bool _has_value;
+
+  struct value_converting_constructor_tag
+  {
+  };
+  struct error_converting_constructor_tag
+  {
+  };
+  struct error_condition_converting_constructor_tag
+  {
+  };
+  struct explicit_valueorerror_converting_constructor_tag
+  {
+  };
+
+  template <class U> static constexpr bool _is_own_sugar = std::is_same<shared_result, std::decay_t<U>>::value || is_success_type<U> || is_failure_type<U>;
+
+  void _retain() const noexcept
+  {
+    if(_value != nullptr)
+    {
+      _value->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  void _release() noexcept
+  {
+    if(_has_value)
+    {
+      if(_value != nullptr && _value->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        delete _value;
+      }
+    }
+    else
+    {
+      _error.~E();
+    }
+  }
+  // Whichever of value or error is in o, this takes a share of it
+  void _copy_from(const shared_result &o) noexcept(std::is_nothrow_copy_constructible<E>::value)
+  {
+    if(o._has_value)
+    {
+      _value = o._value;
+      _retain();
+    }
+    else
+    {
+      new(&_error) E(o._error);
+    }
+    _has_value = o._has_value;
+  }
+  void _move_from(shared_result &&o) noexcept(std::is_nothrow_move_constructible<E>::value)
+  {
+    if(o._has_value)
+    {
+      _value = o._value;
+      o._value = nullptr;
+    }
+    else
+    {
+      new(&_error) E(static_cast<E &&>(o._error));
+    }
+    _has_value = o._has_value;
+  }
+
+public:
+  using value_type = T;
+  using error_type = E;
+
+  shared_result() = delete;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!_is_own_sugar<U> && std::is_constructible<T, U>::value && !std::is_constructible<E, U>::value))
+  shared_result(U &&v, value_converting_constructor_tag /*unused*/ = value_converting_constructor_tag())  // NOLINT
+      : _value(new _box(static_cast<U &&>(v)))
+      , _has_value(true)
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!_is_own_sugar<U> && std::is_constructible<E, U>::value && !std::is_constructible<T, U>::value))
+  shared_result(U &&v, error_converting_constructor_tag /*unused*/ = error_converting_constructor_tag()) noexcept(
+  std::is_nothrow_constructible<E, U>::value)  // NOLINT
+      : _error(static_cast<U &&>(v))
+      , _has_value(false)
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class ErrorCondEnum)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!_is_own_sugar<ErrorCondEnum> &&
+                                  detail::result_predicates<value_type, error_type>::template enable_error_condition_converting_constructor<ErrorCondEnum>))
+  shared_result(ErrorCondEnum &&t, error_condition_converting_constructor_tag /*unused*/ = error_condition_converting_constructor_tag()) noexcept(
+  noexcept(E(make_error_code(static_cast<ErrorCondEnum &&>(t)))))  // NOLINT
+      : _error(make_error_code(t))
+      , _has_value(false)
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class... Args>
+  explicit shared_result(in_place_type_t<T> /*unused*/, Args &&...args)
+      : _value(new _box(static_cast<Args &&>(args)...))
+      , _has_value(true)
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class... Args>
+  explicit shared_result(in_place_type_t<E> /*unused*/, Args &&...args) noexcept(std::is_nothrow_constructible<E, Args...>::value)
+      : _error(static_cast<Args &&>(args)...)
+      , _has_value(false)
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<T, U>::value))
+  shared_result(success_type<U> &&o)  // NOLINT
+      : shared_result(in_place_type<T>, static_cast<success_type<U> &&>(o).value())
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<E, U>::value))
+  shared_result(failure_type<U> &&o) noexcept(std::is_nothrow_constructible<E, U>::value)  // NOLINT
+      : shared_result(in_place_type<E>, static_cast<failure_type<U> &&>(o).error())
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!_is_own_sugar<U> && concepts::value_or_error<std::decay_t<U>>),
+                    OUTCOME_TPRED(std::is_constructible<T, decltype(std::declval<U>().value())>::value &&
+                                  std::is_constructible<E, decltype(std::declval<U>().error())>::value))
+  explicit shared_result(U &&o, explicit_valueorerror_converting_constructor_tag /*unused*/ = explicit_valueorerror_converting_constructor_tag())
+      : _has_value(o.has_value())
+  {
+    if(_has_value)
+    {
+      _value = new _box(static_cast<U &&>(o).value());
+    }
+    else
+    {
+      new(&_error) E(static_cast<U &&>(o).error());
+    }
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  shared_result(const shared_result &o) noexcept(std::is_nothrow_copy_constructible<E>::value) { _copy_from(o); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  shared_result(shared_result &&o) noexcept(std::is_nothrow_move_constructible<E>::value) { _move_from(static_cast<shared_result &&>(o)); }
+  shared_result &operator=(const shared_result &o) noexcept(std::is_nothrow_copy_constructible<E>::value)
+  {
+    if(this != &o)
+    {
+      _release();
+      _copy_from(o);
+    }
+    return *this;
+  }
+  shared_result &operator=(shared_result &&o) noexcept(std::is_nothrow_move_constructible<E>::value)
+  {
+    if(this != &o)
+    {
+      _release();
+      _move_from(static_cast<shared_result &&>(o));
+    }
+    return *this;
+  }
+  ~shared_result() { _release(); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  bool has_value() const noexcept { return _has_value; }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  bool has_error() const noexcept { return !_has_value; }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  explicit operator bool() const noexcept { return _has_value; }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const T &assume_value() const noexcept
+  {
+    OUTCOME_ASSERT(_has_value && _value != nullptr);
+    return _value->value;
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const T &value() const
+  {
+    if(!_has_value)
+    {
+      // Fail exactly as result<T, E> would
+      (void) result<void, E>(in_place_type<E>, _error).value();
+    }
+    return assume_value();
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const E &assume_error() const noexcept
+  {
+    OUTCOME_ASSERT(!_has_value);
+    return _error;
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const E &error() const
+  {
+    if(_has_value)
+    {
+      // Fail exactly as result<T, E> would
+      (void) result<void, E>(in_place_type<void>).error();
+    }
+    return assume_error();
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  auto as_failure() const & { return failure(assume_error()); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  auto as_failure() && { return failure(static_cast<E &&>(_error)); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  size_t use_count() const noexcept { return (_has_value && _value != nullptr) ? _value->refs.load(std::memory_order_relaxed) : 0; }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U, class V)
+  OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<const T &>() == std::declval<const U &>()), OUTCOME_TEXPR(std::declval<const E &>() == std::declval<const V &>()))
+  bool operator==(const shared_result<U, V> &o) const
+  {
+    if(_has_value && o._has_value)
+    {
+      return (static_cast<const void *>(_value) == static_cast<const void *>(o._value)) || assume_value() == o.assume_value();
+    }
+    if(!_has_value && !o._has_value)
+    {
+      return _error == o._error;
+    }
+    return false;
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U, class V)
+  OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<const T &>() == std::declval<const U &>()), OUTCOME_TEXPR(std::declval<const E &>() == std::declval<const V &>()))
+  bool operator!=(const shared_result<U, V> &o) const { return !(*this == o); }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,257 @@
+/* Coalescing of concurrent calls for the same key
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_SINGLE_FLIGHT_HPP
+#define OUTCOME_SINGLE_FLIGHT_HPP
+
+#include "coroutine_support.hpp"
+#include "result.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Key, class Result, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>> class single_flight
+{
+public:
+  using key_type = Key;
+  using result_type = Result;
+
+  struct statistics
+  {
+    uint64_t calls{0};      // invocations of callables
+    uint64_t coalesced{0};  // calls which waited for another's invocation
+  };
+
+private:
+  struct _flight
+  {
+    std::condition_variable ready;
+    std::unique_ptr<const Result> result;
+#ifdef __cpp_exceptions
+    std::exception_ptr exception;
+#endif
+    bool done{false};
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+    std::vector<awaitables::coroutine_handle<>> waiters;
+#endif
+  };
+
+  std::mutex _lock;
+  std::unordered_map<Key, std::shared_ptr<_flight>, Hash, KeyEqual> _flights;
+  std::atomic<uint64_t> _calls{0}, _coalesced{0};
+
+  // Returns the flight for the key, and whether the caller is to perform it
+  std::pair<std::shared_ptr<_flight>, bool> _join(const Key &key)
+  {
+    std::lock_guard<std::mutex> g(_lock);
+    auto it = _flights.find(key);
+    if(it != _flights.end())
+    {
+      _coalesced.fetch_add(1, std::memory_order_relaxed);
+      return {it->second, false};
+    }
+    _calls.fetch_add(1, std::memory_order_relaxed);
+    auto f = std::make_shared<_flight>();
+    _flights.emplace(key, f);
+    return {static_cast<std::shared_ptr<_flight> &&>(f), true};
+  }
+  // Publishes the outcome of the flight, then wakes everything waiting for it
+  void _complete(const Key &key, _flight &f, std::unique_ptr<const Result> r
+#ifdef __cpp_exceptions
+                 ,
+                 std::exception_ptr e
+#endif
+  )
+  {
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+    std::vector<awaitables::coroutine_handle<>> waiters;
+#endif
+    {
+      std::lock_guard<std::mutex> g(_lock);
+      f.result = static_cast<std::unique_ptr<const Result> &&>(r);
+#ifdef __cpp_exceptions
+      f.exception = static_cast<std::exception_ptr &&>(e);
+#endif
+      f.done = true;
+      _flights.erase(key);
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+      waiters.swap(f.waiters);
+#endif
+    }
+    f.ready.notify_all();
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+    for(auto &h : waiters)
+    {
+      h.resume();
+    }
+#endif
+  }
+  // The outcome of a done flight never changes, so it can be read without the lock
+  static Result _get(const _flight &f)
+  {
+#ifdef __cpp_exceptions
+    if(f.exception)
+    {
+      std::rethrow_exception(f.exception);
+    }
+#endif
+    return *f.result;
+  }
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+  struct _flight_awaiter
+  {
+    single_flight *self;
+    std::shared_ptr<_flight> f;
+
+    bool await_ready()
+    {
+      std::lock_guard<std::mutex> g(self->_lock);
+      return f->done;
+    }
+    bool await_suspend(awaitables::coroutine_handle<> h)
+    {
+      std::lock_guard<std::mutex> g(self->_lock);
+      if(f->done)
+      {
+        return false;
+      }
+      f->waiters.push_back(h);
+      return true;
+    }
+    Result await_resume() { return _get(*f); }
+  };
+#endif
+
+public:
+  single_flight() = default;
+  single_flight(const single_flight &) = delete;
+  single_flight(single_flight &&) = delete;
+  single_flight &operator=(const single_flight &) = delete;
+  single_flight &operator=(single_flight &&) = delete;
+  ~single_flight() = default;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class F> Result call(const Key &key, F &&f)
+  {
+    auto j = _join(key);
+    if(!j.second)
+    {
+      std::unique_lock<std::mutex> g(_lock);
+      j.first->ready.wait(g, [&] { return j.first->done; });
+      g.unlock();
+      return _get(*j.first);
+    }
+#ifdef __cpp_exceptions
+    try
+#endif
+    {
+      std::unique_ptr<const Result> r(new Result(static_cast<F &&>(f)()));
+      Result ret(*r);
+      _complete(key, *j.first, static_cast<std::unique_ptr<const Result> &&>(r)
+#ifdef __cpp_exceptions
+                                 ,
+                std::exception_ptr()
+#endif
+      );
+      return ret;
+    }
+#ifdef __cpp_exceptions
+    catch(...)
+    {
+      _complete(key, *j.first, nullptr, std::current_exception());
+      throw;
+    }
+#endif
+  }
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class F> awaitables::atomic_eager<Result> co_call(Key key, F f)
+  {
+    auto j = _join(key);
+    if(!j.second)
+    {
+      _flight_awaiter w{this, j.first};
+      co_return co_await w;
+    }
+#ifdef __cpp_exceptions
+    std::exception_ptr e;
+    try
+#endif
+    {
+      std::unique_ptr<const Result> r(new Result(co_await f()));
+      Result ret(*r);
+      _complete(key, *j.first, static_cast<std::unique_ptr<const Result> &&>(r)
+#ifdef __cpp_exceptions
+                                 ,
+                std::exception_ptr()
+#endif
+      );
+      co_return ret;
+    }
+#ifdef __cpp_exceptions
+    catch(...)
+    {
+      e = std::current_exception();
+    }
+    // co_await may not appear in a handler, but f() might have been, so this is done outside it
+    _complete(key, *j.first, nullptr, e);
+    std::rethrow_exception(e);
+#endif
+  }
+#endif
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  statistics stats() const noexcept
+  {
+    statistics ret;
+    ret.calls = _calls.load(std::memory_order_relaxed);
+    ret.coalesced = _coalesced.load(std::memory_order_relaxed);
+    return ret;
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
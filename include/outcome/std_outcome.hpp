@@ -28,11 +28,32 @@ Distributed under the Boost Software License, Version 1.0.
 #include "basic_outcome.hpp"
 #include "std_result.hpp"
 
+#if OUTCOME_ENABLE_FAILURE_EXCEPTION_CACHE
+#include "detail/failure_exception_cache.hpp"
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  struct std_error_code_exceptions;
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+#endif
+
 #ifndef STD_BASIC_OUTCOME_FAILURE_EXCEPTION_FROM_ERROR
 #define STD_BASIC_OUTCOME_FAILURE_EXCEPTION_FROM_ERROR
-namespace std  // NOLINT
+OUTCOME_V2_CXX_MODULE_EXPORT namespace std  // NOLINT
 {
+#if OUTCOME_ENABLE_FAILURE_EXCEPTION_CACHE
+  // Reuses the exception synthesised for the same error code
+  inline exception_ptr basic_outcome_failure_exception_from_error(const error_code &ec)
+  {
+    using cache = OUTCOME_V2_NAMESPACE::detail::failure_exception_cache<OUTCOME_V2_NAMESPACE::detail::std_error_code_exceptions, exception_ptr>;
+    return cache::get().lookup(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&ec.category())), ec.value(),
+                               [&] { return make_exception_ptr(system_error(ec)); });
+  }
+#else
   inline exception_ptr basic_outcome_failure_exception_from_error(const error_code &ec) { return make_exception_ptr(system_error(ec)); }
+#endif
 }  // namespace std
 #endif
 
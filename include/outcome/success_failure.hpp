@@ -304,12 +304,12 @@ namespace detail
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_success_type = detail::is_success_type<std::decay_t<T>>::value;
+template <class T> constexpr bool is_success_type = detail::is_success_type<std::decay_t<T>>::value;
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_failure_type = detail::is_failure_type<std::decay_t<T>>::value;
+template <class T> constexpr bool is_failure_type = detail::is_failure_type<std::decay_t<T>>::value;
 
 OUTCOME_V2_NAMESPACE_END
 
@@ -35,7 +35,7 @@ namespace trait
 SIGNATURE NOT RECOGNISED
 */
   template <class R>                                                             //
-  static constexpr bool type_can_be_used_in_basic_result =                       //
+  constexpr bool type_can_be_used_in_basic_result =                              //
   (!std::is_reference<R>::value                                                  //
    && !OUTCOME_V2_NAMESPACE::detail::is_in_place_type_t<std::decay_t<R>>::value  //
    && !is_success_type<R>                                                        //
@@ -0,0 +1,303 @@
+/* Benchmark of C Result propagation
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Prints the average nanoseconds taken to propagate a success and a failure
+up a deep call chain, and to unwind a function acquiring several resources,
+for each of idiomatic errno style C and C Result. Every call is made through
+a function pointer so the compiler cannot flatten the chain.
+*/
+
+#include "benchmark.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ITERATIONS 1000000
+#define DEPTH 16
+#define RESOURCES 4
+
+static uint64_t nanoseconds(void)
+{
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+volatile intptr_t forcereturn;
+volatile int released;
+
+/********************************* Deep call chains *********************************/
+
+// Returns -1 and sets errno on failure, as most of POSIX does
+static int errno_chain(int depth, int fail, intptr_t *out);
+static int (*volatile errno_chain_ptr)(int, int, intptr_t *) = errno_chain;
+static int errno_chain(int depth, int fail, intptr_t *out)
+{
+  if(depth == 0)
+  {
+    if(fail)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+    *out = 0;
+    return 0;
+  }
+  intptr_t v;
+  if(errno_chain_ptr(depth - 1, fail, &v) < 0)
+  {
+    return -1;
+  }
+  *out = v + 1;
+  return 0;
+}
+
+// Returns the negated error code on failure, as the Linux kernel does
+static int negerr_chain(int depth, int fail, intptr_t *out);
+static int (*volatile negerr_chain_ptr)(int, int, intptr_t *) = negerr_chain;
+static int negerr_chain(int depth, int fail, intptr_t *out)
+{
+  if(depth == 0)
+  {
+    if(fail)
+    {
+      return -EINVAL;
+    }
+    *out = 0;
+    return 0;
+  }
+  intptr_t v;
+  int ret = negerr_chain_ptr(depth - 1, fail, &v);
+  if(ret < 0)
+  {
+    return ret;
+  }
+  *out = v + 1;
+  return 0;
+}
+
+static bench_result result_chain(int depth, int fail);
+static bench_result (*volatile result_chain_ptr)(int, int) = result_chain;
+static bench_result result_chain(int depth, int fail)
+{
+  if(depth == 0)
+  {
+    if(fail)
+    {
+      return CXX_MAKE_RESULT_SYSTEM_FAILURE_POSIX(bench, EINVAL);
+    }
+    return CXX_MAKE_RESULT_SYSTEM_SUCCESS(bench, 0);
+  }
+  CXX_RESULT_SYSTEM_TRY(intptr_t v, bench, /* no cleanup */, result_chain_ptr(depth - 1, fail));
+  return CXX_MAKE_RESULT_SYSTEM_SUCCESS(bench, v + 1);
+}
+
+/****************************** Multi-resource cleanup ******************************/
+
+static int errno_acquire(int n, int fail, intptr_t *out);
+static int (*volatile errno_acquire_ptr)(int, int, intptr_t *) = errno_acquire;
+static int errno_acquire(int n, int fail, intptr_t *out)
+{
+  if(n == fail)
+  {
+    errno = ENOMEM;
+    return -1;
+  }
+  *out = n;
+  return 0;
+}
+
+static bench_result result_acquire(int n, int fail);
+static bench_result (*volatile result_acquire_ptr)(int, int) = result_acquire;
+static bench_result result_acquire(int n, int fail)
+{
+  if(n == fail)
+  {
+    return CXX_MAKE_RESULT_SYSTEM_FAILURE_POSIX(bench, ENOMEM);
+  }
+  return CXX_MAKE_RESULT_SYSTEM_SUCCESS(bench, n);
+}
+
+static void release(intptr_t r)
+{
+  released = (int) r;
+}
+
+// Acquires RESOURCES resources, failing to acquire the one numbered fail if
+// it is less than RESOURCES
+static int errno_resources(int fail, intptr_t *out)
+{
+  int ret = -1;
+  intptr_t r0, r1, r2, r3;
+  if(errno_acquire_ptr(0, fail, &r0) < 0)
+  {
+    goto fail0;
+  }
+  if(errno_acquire_ptr(1, fail, &r1) < 0)
+  {
+    goto fail1;
+  }
+  if(errno_acquire_ptr(2, fail, &r2) < 0)
+  {
+    goto fail2;
+  }
+  if(errno_acquire_ptr(3, fail, &r3) < 0)
+  {
+    goto fail3;
+  }
+  *out = r0 + r1 + r2 + r3;
+  ret = 0;
+  release(r3);
+fail3:
+  release(r2);
+fail2:
+  release(r1);
+fail1:
+  release(r0);
+fail0:
+  return ret;
+}
+
+static bench_result result_resources(int fail)
+{
+  bench_result ret = CXX_MAKE_RESULT_SYSTEM_SUCCESS(bench, 0);
+  intptr_t r0, r1, r2, r3;
+  CXX_RESULT_SYSTEM_TRY_GOTO(r0, ret, fail0, result_acquire_ptr(0, fail));
+  CXX_RESULT_SYSTEM_TRY_GOTO(r1, ret, fail1, result_acquire_ptr(1, fail));
+  CXX_RESULT_SYSTEM_TRY_GOTO(r2, ret, fail2, result_acquire_ptr(2, fail));
+  CXX_RESULT_SYSTEM_TRY_GOTO(r3, ret, fail3, result_acquire_ptr(3, fail));
+  ret.value = r0 + r1 + r2 + r3;
+  release(r3);
+fail3:
+  release(r2);
+fail2:
+  release(r1);
+fail1:
+  release(r0);
+fail0:
+  return ret;
+}
+
+/************************************ The harness ***********************************/
+
+static void report(const char *name, uint64_t start, uint64_t end, int calls)
+{
+  printf("%s: %f ns\n", name, (double) (end - start) / ITERATIONS / calls);
+}
+
+static void benchmark_chains(int fail)
+{
+  const char *what = fail ? "failure" : "success";
+  char name[64];
+  uint64_t start, end;
+  intptr_t v = 0;
+  int n;
+
+  start = nanoseconds();
+  for(n = 0; n < ITERATIONS; n++)
+  {
+    if(errno_chain_ptr(DEPTH, fail, &v) < 0)
+    {
+      v = errno;
+    }
+    forcereturn = v;
+  }
+  end = nanoseconds();
+  snprintf(name, sizeof(name), "int + errno %s, per frame", what);
+  report(name, start, end, DEPTH + 1);
+
+  start = nanoseconds();
+  for(n = 0; n < ITERATIONS; n++)
+  {
+    int ret = negerr_chain_ptr(DEPTH, fail, &v);
+    if(ret < 0)
+    {
+      v = -ret;
+    }
+    forcereturn = v;
+  }
+  end = nanoseconds();
+  snprintf(name, sizeof(name), "negative errno %s, per frame", what);
+  report(name, start, end, DEPTH + 1);
+
+  start = nanoseconds();
+  for(n = 0; n < ITERATIONS; n++)
+  {
+    bench_result r = result_chain_ptr(DEPTH, fail);
+    forcereturn = CXX_RESULT_HAS_VALUE(r) ? r.value : r.error.value;
+  }
+  end = nanoseconds();
+  snprintf(name, sizeof(name), "C Result %s, per frame", what);
+  report(name, start, end, DEPTH + 1);
+}
+
+static void benchmark_resources(int fail)
+{
+  char name[64];
+  uint64_t start, end;
+  intptr_t v = 0;
+  int n;
+
+  start = nanoseconds();
+  for(n = 0; n < ITERATIONS; n++)
+  {
+    if(errno_resources(fail, &v) < 0)
+    {
+      v = errno;
+    }
+    forcereturn = v;
+  }
+  end = nanoseconds();
+  snprintf(name, sizeof(name), "int + errno cleanup chain, %s %d", (fail < RESOURCES) ? "failing at" : "acquiring all", fail);
+  report(name, start, end, 1);
+
+  start = nanoseconds();
+  for(n = 0; n < ITERATIONS; n++)
+  {
+    bench_result r = result_resources(fail);
+    forcereturn = CXX_RESULT_HAS_VALUE(r) ? r.value : r.error.value;
+  }
+  end = nanoseconds();
+  snprintf(name, sizeof(name), "C Result cleanup chain, %s %d", (fail < RESOURCES) ? "failing at" : "acquiring all", fail);
+  report(name, start, end, 1);
+}
+
+int main(void)
+{
+  int fail;
+  {
+    uint64_t start = nanoseconds();
+    while(nanoseconds() - start < 1000000000ULL)
+      ;
+  }
+  benchmark_chains(0);
+  benchmark_chains(1);
+  for(fail = 0; fail <= RESOURCES; fail++)
+  {
+    benchmark_resources(fail);
+  }
+  return 0;
+}
@@ -0,0 +1,33 @@
+/* Benchmark of C Result propagation
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_TEST_LINK_EXPERIMENTAL_C_RESULT_BENCHMARK_H
+#define OUTCOME_TEST_LINK_EXPERIMENTAL_C_RESULT_BENCHMARK_H
+
+#include <outcome/experimental/result.h>
+
+CXX_DECLARE_RESULT_SYSTEM(bench, intptr_t);
+
+typedef CXX_RESULT_SYSTEM(bench) bench_result;
+
+#endif
@@ -62,12 +62,12 @@ static mylib_result make_failure_result(int v)
 
 static int is_result_equivalent(mylib_result r, int errcode)
 {
-  return outcome_status_code_equal_generic(&r, errcode);
+  return outcome_status_code_equal_generic(&r.error, errcode);
 }
 
 static const char *result_failure_message(mylib_result r)
 {
-  return outcome_status_code_message(&r);
+  return outcome_status_code_message(&r.error);
 }
 
 extern MYLIB_DECL mylib_result test_function(int x);
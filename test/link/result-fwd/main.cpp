@@ -0,0 +1,38 @@
+/* Link testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "lib.hpp"
+#include "results.hpp"
+
+int main()
+{
+  if(mylib::parse("3").value() != 3)
+  {
+    return 1;
+  }
+  if(mylib::describe("x").error() != std::errc::invalid_argument)
+  {
+    return 1;
+  }
+  return mylib::describe("4").value() == "4" ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+/* Link testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_TEST_LINK_RESULT_FWD_RESULTS_HPP
+#define OUTCOME_TEST_LINK_RESULT_FWD_RESULTS_HPP
+
+#include <outcome/result.hpp>
+
+#include <string>
+
+// These result types are instantiated once, in lib.cpp
+OUTCOME_EXTERN_RESULT(int, std::error_code);
+OUTCOME_EXTERN_RESULT(std::string, std::error_code);
+
+#endif
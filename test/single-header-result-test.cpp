@@ -0,0 +1,66 @@
+/* Core result only single header test
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../single-header/outcome-result.hpp"
+
+// This edition must be usable without anything else, and must not drag in
+// iostreams, coroutines or basic_outcome
+#if defined(_GLIBCXX_IOSTREAM) || defined(_LIBCPP_IOSTREAM) || defined(_IOSTREAM_)
+#error "outcome-result.hpp included <iostream>"
+#endif
+#if defined(OUTCOME_IOSTREAM_SUPPORT_HPP) || defined(OUTCOME_COROUTINE_SUPPORT_HPP) || defined(OUTCOME_BASIC_OUTCOME_HPP)
+#error "outcome-result.hpp included more than result and try"
+#endif
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+static outcome::result<int> parse(const char *s) noexcept
+{
+  if(*s < '0' || *s > '9')
+  {
+    return std::errc::invalid_argument;
+  }
+  return *s - '0';
+}
+
+static outcome::result<void> twice(const char *s, int &out) noexcept
+{
+  OUTCOME_TRY(auto v, parse(s));
+  out = v * 2;
+  return outcome::success();
+}
+
+int main()
+{
+  int v = 0;
+  if(!twice("4", v) || v != 8)
+  {
+    return 1;
+  }
+  if(twice("x", v).error() != std::errc::invalid_argument)
+  {
+    return 1;
+  }
+  outcome::unchecked<void, int> f(outcome::failure(5));
+  return f.error() == 5 ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/catching.hpp"
+#include "../../include/outcome/experimental/catching.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace catching_test
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+
+  struct third_party_error : std::runtime_error
+  {
+    int code;
+    third_party_error(int c)
+        : std::runtime_error("third party error")
+        , code(c)
+    {
+    }
+  };
+  struct unknown_error
+  {
+  };
+
+  // Stands in for a third party function which reports failure by throwing
+  inline int parse(const std::string &s)
+  {
+#ifdef __cpp_exceptions
+    if(s.empty())
+    {
+      throw std::invalid_argument("empty");
+    }
+    if(s == "overflow")
+    {
+      throw std::overflow_error("overflow");
+    }
+    if(s == "third party")
+    {
+      throw third_party_error(EBADMSG);
+    }
+    if(s == "unknown")
+    {
+      throw unknown_error();
+    }
+#endif
+    return static_cast<int>(s.size());
+  }
+}  // namespace catching_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_catching, "Tests that catching() calls the callable, returning what it returned")
+{
+  using namespace catching_test;
+  const std::string hello("hello");
+  auto r = catching(parse, hello);
+  static_assert(std::is_same<decltype(r), outcome<int>>::value, "");
+  static_assert(noexcept(catching(parse, hello)), "");
+  BOOST_CHECK(r.value() == 5);
+
+  // Move only values and arguments are forwarded
+  auto p = catching([](std::unique_ptr<int> v) { return v; }, std::make_unique<int>(78));
+  BOOST_REQUIRE(p.has_value());
+  BOOST_CHECK(*p.value() == 78);
+
+  int calls = 0;
+  auto v = catching([&] { ++calls; });
+  static_assert(std::is_same<decltype(v), outcome<void>>::value, "");
+  BOOST_CHECK(v.has_value());
+  BOOST_CHECK(calls == 1);
+
+  auto s = catching<experimental::status_result<int>>(parse, std::string("hi"));
+  BOOST_CHECK(s.value() == 2);
+}
+
+#ifdef __cpp_exceptions
+BOOST_OUTCOME_AUTO_TEST_CASE(works_catching_default_mapping, "Tests that catching() maps standard exceptions as error_from_exception() does")
+{
+  using namespace catching_test;
+  {
+    auto r = catching(parse, std::string());
+    BOOST_CHECK(r.has_error());
+    BOOST_CHECK(!r.has_exception());
+    BOOST_CHECK(r.error() == std::errc::invalid_argument);
+    BOOST_CHECK(catching(parse, std::string("overflow")).error() == std::errc::value_too_large);
+    // Without a matching error, outcome keeps the exception
+    auto u = catching(parse, std::string("unknown"));
+    BOOST_CHECK(!u.has_error());
+    BOOST_CHECK(u.has_exception());
+    BOOST_CHECK_THROW(u.value(), unknown_error);
+  }
+  {
+    // result has nowhere to keep the exception, so it gets the error for unmatched exceptions
+    auto r = catching<result<int>>(parse, std::string());
+    BOOST_CHECK(r.error() == std::errc::invalid_argument);
+    auto u = catching<result<int>>(parse, std::string("unknown"));
+    BOOST_CHECK(u.error() == std::errc::resource_unavailable_try_again);
+  }
+  {
+    // Status code results map via system_code_from_exception()
+    auto r = catching<experimental::status_result<int>>(parse, std::string());
+    BOOST_CHECK(r.error() == experimental::errc::invalid_argument);
+    auto u = catching<experimental::status_outcome<int>>(parse, std::string("unknown"));
+    BOOST_CHECK(u.has_exception());
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_catching_mapping, "Tests that catching() maps exceptions by a mapping table before the default mapping")
+{
+  using namespace catching_test;
+  static const auto mapping = make_exception_mapping(                                                                         //
+  map_exception<third_party_error>([](const third_party_error &e) { return std::error_code(e.code, std::generic_category()); }),  //
+  map_exception<std::runtime_error>(std::errc::io_error),                                                                        //
+  map_exception<unknown_error>(std::errc::not_supported),                                                                        //
+  map_exception<std::overflow_error>(std::errc::result_out_of_range));
+  BOOST_CHECK(catching(mapping, parse, std::string("hello")).value() == 5);
+  // The first entry matching wins, so derived exceptions must come before their bases
+  BOOST_CHECK(catching(mapping, parse, std::string("third party")).error() == std::errc::bad_message);
+  BOOST_CHECK(catching(mapping, parse, std::string("overflow")).error() == std::errc::io_error);
+  BOOST_CHECK(catching(mapping, parse, std::string("unknown")).error() == std::errc::not_supported);
+  BOOST_CHECK(catching<result<int>>(mapping, parse, std::string("unknown")).error() == std::errc::not_supported);
+  // Exceptions not in the table get the default mapping
+  BOOST_CHECK(catching(mapping, parse, std::string()).error() == std::errc::invalid_argument);
+  BOOST_CHECK(catching(mapping, [] { throw 5; }).has_exception());
+
+  // Mappings can produce status codes too
+  static const auto status_mapping = make_exception_mapping(map_exception<unknown_error>(experimental::errc::not_supported));
+  BOOST_CHECK(catching<experimental::status_result<int>>(status_mapping, parse, std::string("unknown")).error() == experimental::errc::not_supported);
+}
+#endif
@@ -0,0 +1,184 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/circuit_breaker.hpp"
+#include "../../include/outcome/result.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_circuit_breaker, "Tests that circuit_breaker opens upon too many failures in one error domain, and closes again")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  circuit_breaker::config config;
+  config.minimum_calls = 4;
+  config.failure_ratio = 0.5;
+  config.open_duration = std::chrono::milliseconds(50);
+  int calls = 0;
+  auto succeeds = [&]() -> result<int> { return ++calls; };
+  auto fails_generic = [&]() -> result<int> {
+    ++calls;
+    return std::errc::connection_refused;
+  };
+  auto fails_system = [&]() -> result<int> {
+    ++calls;
+    return std::error_code(5, std::system_category());
+  };
+  {
+    // Failures spread over domains, or before the minimum calls, don't open the circuit
+    circuit_breaker cb(config);
+    (void) cb.call(fails_generic);
+    (void) cb.call(fails_generic);
+    (void) cb.call(fails_generic);
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::closed);
+    cb.reset();
+    (void) cb.call(fails_generic);
+    (void) cb.call(fails_system);
+    (void) cb.call(succeeds);
+    (void) cb.call(succeeds);
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::closed);
+    auto s = cb.stats();
+    BOOST_CHECK(s.calls == 7);
+    BOOST_CHECK(s.failures == 5);
+    BOOST_CHECK(s.window_calls == 4);
+    BOOST_CHECK(std::strcmp(s.domains[0].name, std::generic_category().name()) == 0);
+    BOOST_CHECK(s.domains[0].failures == 4);
+    BOOST_CHECK(s.domains[0].window_failures == 1);
+    BOOST_CHECK(std::strcmp(s.domains[1].name, std::system_category().name()) == 0);
+    BOOST_CHECK(s.domains[1].failures == 1);
+    BOOST_CHECK(s.domains[2].key == 0);
+    // Now one domain fails too often
+    (void) cb.call(fails_generic);
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::closed);
+    (void) cb.call(fails_generic);
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::open);
+  }
+  {
+    circuit_breaker cb(config);
+    (void) cb.call(succeeds);
+    (void) cb.call(succeeds);
+    (void) cb.call(fails_generic);
+    (void) cb.call(fails_generic);
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::open);
+    // Whilst open, calls are short circuited without invoking the callable
+    calls = 0;
+    auto r = cb.call(succeeds);
+    BOOST_CHECK(calls == 0);
+    BOOST_CHECK(r.error() == circuit_breaker_errc::circuit_open);
+    BOOST_CHECK(r.error().message() == "circuit open");
+    auto s = cb.stats();
+    BOOST_CHECK(s.opened == 1);
+    BOOST_CHECK(s.rejected == 1);
+    // After the open duration, a failing probe opens it again
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::half_open);
+    (void) cb.call(fails_generic);
+    BOOST_CHECK(calls == 1);
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::open);
+    BOOST_CHECK(cb.stats().opened == 2);
+    // And a succeeding probe closes it
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    BOOST_CHECK(cb.call(succeeds).value() == 2);
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::closed);
+    BOOST_CHECK(cb.stats().window_calls == 0);
+  }
+  {
+    // Errors which are not failures of the backend don't count
+    circuit_breaker cb(config);
+    auto only_refused = [](const std::error_code &ec) { return ec != std::errc::no_such_file_or_directory; };
+    for(int n = 0; n < 8; n++)
+    {
+      (void) cb.call([]() -> result<int> { return std::errc::no_such_file_or_directory; }, only_refused);
+    }
+    BOOST_CHECK(cb.state() == circuit_breaker::state_type::closed);
+    BOOST_CHECK(cb.stats().successes == 8);
+  }
+  {
+    // Concurrent use
+    config.minimum_calls = 1000000;
+    circuit_breaker cb(config);
+    std::vector<std::thread> threads;
+    for(int n = 0; n < 4; n++)
+    {
+      threads.emplace_back([&cb, n] {
+        for(int i = 0; i < 1000; i++)
+        {
+          (void) cb.call([&]() -> result<int> {
+            if(i % 2 == 0)
+            {
+              return std::errc::connection_refused;
+            }
+            return n;
+          });
+        }
+      });
+    }
+    for(auto &i : threads)
+    {
+      i.join();
+    }
+    auto s = cb.stats();
+    BOOST_CHECK(s.calls == 4000);
+    BOOST_CHECK(s.failures == 2000);
+    BOOST_CHECK(s.domains[0].failures == 2000);
+  }
+}
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+namespace circuit_breaker_coroutines
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+
+  inline awaitables::eager<result<int>> backend(int &calls, bool fail)
+  {
+    ++calls;
+    if(fail)
+    {
+      co_return std::errc::connection_refused;
+    }
+    co_return 5;
+  }
+  inline awaitables::eager<result<int>> drive(awaitables::lazy<result<int>> t) { co_return co_await std::move(t); }
+}  // namespace circuit_breaker_coroutines
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_circuit_breaker_coroutines, "Tests that circuit_breaker short circuits awaitables whilst open")
+{
+  using namespace circuit_breaker_coroutines;
+  circuit_breaker::config config;
+  config.minimum_calls = 2;
+  circuit_breaker cb(config);
+  int calls = 0;
+  auto run = [&](bool fail) {
+    auto t = drive(cb.co_call([&] { return backend(calls, fail); }));
+    BOOST_REQUIRE(t.await_ready());
+    return t.await_resume();
+  };
+  BOOST_CHECK(run(false).value() == 5);
+  BOOST_CHECK(run(true).error() == std::errc::connection_refused);
+  BOOST_CHECK(cb.state() == circuit_breaker::state_type::open);
+  BOOST_CHECK(run(false).error() == circuit_breaker_errc::circuit_open);
+  BOOST_CHECK(calls == 2);
+}
+#endif
@@ -420,6 +420,35 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / result, "Tests that the result works as int
   }
 
 #ifndef TESTING_WG21_EXPERIMENTAL_RESULT
+  // Test errors of generic category know they are errno
+  {
+    result<int> a(std::errc::resource_unavailable_try_again), b(std::make_error_code(std::errc::interrupted)), c(5);
+    BOOST_CHECK(a.error_is_errno(EAGAIN));
+    BOOST_CHECK(!a.error_is_errno(EINTR));
+    BOOST_CHECK(b.error_is_errno(EINTR));
+    BOOST_CHECK(!c.error_is_errno(0));
+    result<int> d(std::error_code(EAGAIN, std::iostream_category()));
+    BOOST_CHECK(!d.error_is_errno(EAGAIN));
+
+    // Converting to an error type which does not carry errno drops the knowledge
+    struct wrapped_error
+    {
+      std::error_code ec;
+      wrapped_error(std::error_code _ec)  // NOLINT
+          : ec(_ec)
+      {
+      }
+    };
+    struct errno_probe : OUTCOME_V2_NAMESPACE::policy::base
+    {
+      static bool error_is_errno(const result<int, wrapped_error> &r) noexcept { return _has_error_is_errno(r); }
+    };
+    result<int, wrapped_error> e(a), f(std::move(b));
+    BOOST_CHECK(!errno_probe::error_is_errno(e));
+    BOOST_CHECK(!errno_probe::error_is_errno(f));
+    result<int> g(result<int, std::errc>(std::errc::interrupted));
+    BOOST_CHECK(g.error_is_errno(EINTR));
+  }
 #ifdef __cpp_exceptions
   // Test payload facility
   {
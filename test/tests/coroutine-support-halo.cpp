@@ -0,0 +1,131 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/coroutine_support.hpp"
+#include "../../include/outcome/try.hpp"
+
+#if OUTCOME_FOUND_COROUTINE_HEADER
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"  // GCC sees through the replacement below
+#endif
+
+// Counts every dynamic memory allocation made by this program
+static size_t allocations;
+void *operator new(size_t bytes)
+{
+  ++allocations;
+  if(void *ret = malloc(bytes))
+  {
+    return ret;
+  }
+#ifdef __cpp_exceptions
+  throw std::bad_alloc();
+#else
+  abort();
+#endif
+}
+void operator delete(void *p) noexcept
+{
+  free(p);
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  free(p);
+}
+
+namespace coroutines
+{
+  template <class T> using lazy = OUTCOME_V2_NAMESPACE::awaitables::lazy<T>;
+  template <class T> using scoped_lazy = OUTCOME_V2_NAMESPACE::awaitables::scoped_lazy<T>;
+  template <class T, class E = std::error_code> using result = OUTCOME_V2_NAMESPACE::result<T, E>;
+
+  inline scoped_lazy<result<int>> scoped_int(int x)
+  {
+    if(x < 0)
+    {
+      co_return std::errc::invalid_argument;
+    }
+    co_return x + 1;
+  }
+  inline scoped_lazy<void> scoped_void(int &x)
+  {
+    ++x;
+    co_return;
+  }
+  inline lazy<result<int>> sum_scoped(int n)
+  {
+    int ret = 0;
+    for(int i = 0; i < n; i++)
+    {
+      OUTCOME_CO_TRY(auto v, co_await scoped_int(i));
+      ret += v;
+      co_await scoped_void(ret);
+    }
+    OUTCOME_CO_TRYV(co_await scoped_int(-1));
+    co_return ret;
+  }
+}  // namespace coroutines
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / halo, "Tests that scoped_lazy coroutine frames can be elided")
+{
+  using namespace coroutines;
+  static constexpr int iterations = 100;
+  auto t = sum_scoped(iterations);
+  BOOST_CHECK(!t.await_ready());
+  const auto before = allocations;
+#if OUTCOME_HAVE_NOOP_COROUTINE
+  t.await_suspend({}).resume();
+#else
+  t.await_suspend({});
+#endif
+  const auto made = allocations - before;
+  BOOST_REQUIRE(t.await_ready());
+  BOOST_CHECK(t.await_resume().error() == std::errc::invalid_argument);
+  std::cout << "Awaiting " << (2 * iterations + 1) << " scoped_lazy made " << made << " dynamic memory allocations" << std::endl;
+#if defined(__clang__) && defined(__OPTIMIZE__) && defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::coro_await_elidable)
+#define COROUTINE_SUPPORT_HALO_GUARANTEED 1
+#endif
+#endif
+#ifdef COROUTINE_SUPPORT_HALO_GUARANTEED
+  // Clang guarantees elision of frames immediately awaited when optimising
+  BOOST_CHECK(made == 0);
+#else
+  // Elsewhere elision is at the optimiser's discretion, and GCC allocates every frame
+  std::cout << "NOTE: This compiler does not guarantee elision of coroutine frames, so their allocations are not checked" << std::endl;
+#endif
+}
+
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
@@ -33,7 +33,10 @@ namespace coroutines
 {
   template <class T> using eager = OUTCOME_V2_NAMESPACE::awaitables::eager<T>;
   template <class T> using lazy = OUTCOME_V2_NAMESPACE::awaitables::lazy<T>;
+  template <class T> using atomic_eager = OUTCOME_V2_NAMESPACE::awaitables::atomic_eager<T>;
+  template <class T> using atomic_lazy = OUTCOME_V2_NAMESPACE::awaitables::atomic_lazy<T>;
   template <class T> using generator = OUTCOME_V2_NAMESPACE::awaitables::generator<T>;
+  template <class T> using async_generator = OUTCOME_V2_NAMESPACE::awaitables::async_generator<T>;
   template <class T, class E = std::error_code> using result = OUTCOME_V2_NAMESPACE::result<T, E>;
 
   inline eager<result<int>> eager_int(int x) { co_return x + 1; }
@@ -42,6 +45,7 @@ namespace coroutines
   inline lazy<result<int>> lazy_error() { co_return std::errc::not_enough_memory; }
   inline eager<result<void>> eager_void() { co_return std::errc::not_enough_memory; }
   inline lazy<result<void>> lazy_void() { co_return std::errc::not_enough_memory; }
+  inline lazy<result<void>> lazy_void2_result() { co_return OUTCOME_V2_NAMESPACE::success(); }
   inline generator<result<int>> generator_int(int x)
   {
     co_yield x;
@@ -90,10 +94,146 @@ namespace coroutines
   }
 #endif
 
+  // Stands in for an i/o completion which some third party signals later
+  struct io_event
+  {
+    OUTCOME_V2_NAMESPACE::awaitables::coroutine_handle<> waiter;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(OUTCOME_V2_NAMESPACE::awaitables::coroutine_handle<> h) noexcept { waiter = h; }
+    void await_resume() noexcept {}
+    void signal()
+    {
+      auto h = waiter;
+      waiter = nullptr;
+      h.resume();
+    }
+  };
+  inline async_generator<result<int>> async_generator_int(io_event &ev, int x)
+  {
+    co_yield x;
+    co_await ev;
+    co_yield x + 1;
+    co_await ev;
+    co_yield x + 2;
+  }
+  inline async_generator<result<int>> async_generator_error(int &produced, int x)
+  {
+    ++produced;
+    co_yield x;
+    ++produced;
+    co_yield std::errc::not_enough_memory;
+    ++produced;  // must never be reached
+    co_yield x + 2;
+  }
+  inline lazy<result<int>> async_generator_sum(async_generator<result<int>> g)
+  {
+    int total = 0;
+    while(co_await g.next())
+    {
+      OUTCOME_CO_TRY(auto v, g());
+      total += v;
+    }
+    co_return total;
+  }
+  inline lazy<int> async_generator_count(async_generator<result<int>> g)
+  {
+    int count = 0;
+    while(co_await g.next())
+    {
+      (void) g();
+      count++;
+    }
+    BOOST_CHECK(g.done());
+    co_return count;
+  }
+
+  inline lazy<result<int>> lazy_int_after(io_event &ev, int x)
+  {
+    co_await ev;
+    co_return x;
+  }
+  inline lazy<result<int>> lazy_int_counted(int &started, int x)
+  {
+    ++started;
+    co_return x;
+  }
+  inline lazy<result<int>> lazy_error_counted(int &started)
+  {
+    ++started;
+    co_return std::errc::not_enough_memory;
+  }
+  inline lazy<result<int>> lazy_error_after(io_event &ev)
+  {
+    co_await ev;
+    co_return std::errc::not_enough_memory;
+  }
+  inline lazy<result<int>> lazy_int_after_then_child(io_event &ev, int &started)
+  {
+    co_await ev;
+    OUTCOME_CO_TRY(auto v, co_await lazy_int_counted(started, 1));
+    co_return v;
+  }
+  inline lazy<result<int>> lazy_stop_requested_after(io_event &ev)
+  {
+    co_await ev;
+    auto token = co_await OUTCOME_V2_NAMESPACE::awaitables::get_stop_token();
+    BOOST_CHECK(token.stop_possible());
+    if(token.stop_requested())
+    {
+      co_return std::errc::operation_canceled;
+    }
+    co_return 1;
+  }
+  inline lazy<result<int>> stop_not_possible()
+  {
+    auto token = co_await OUTCOME_V2_NAMESPACE::awaitables::get_stop_token();
+    BOOST_CHECK(!token.stop_possible());
+    BOOST_CHECK(!token.stop_requested());
+    co_return 1;
+  }
+  inline lazy<result<int>> when_all_sum(eager<result<int>> a, lazy<result<int>> b, lazy<result<void>> c)
+  {
+    OUTCOME_CO_TRY(auto &&v, co_await OUTCOME_V2_NAMESPACE::awaitables::when_all(std::move(a), std::move(b), std::move(c)));
+    co_return std::get<0>(v) + std::get<1>(v);
+  }
+  inline lazy<result<int>> when_all_sum(lazy<result<int>> a, lazy<result<int>> b)
+  {
+    OUTCOME_CO_TRY(auto &&v, co_await OUTCOME_V2_NAMESPACE::awaitables::when_all(std::move(a), std::move(b)));
+    co_return std::get<0>(v) + std::get<1>(v);
+  }
+  inline lazy<result<int>> when_any_of(lazy<result<int>> a, lazy<result<int>> b, lazy<result<int>> c)
+  {
+    co_return co_await OUTCOME_V2_NAMESPACE::awaitables::when_any(std::move(a), std::move(b), std::move(c));
+  }
+
+  inline atomic_eager<result<int>> atomic_eager_int(int x) { co_return x + 1; }
+  inline atomic_eager<result<int>> atomic_eager_int_after(io_event &ev, int x)
+  {
+    co_await ev;
+    co_return x;
+  }
+  inline atomic_lazy<result<int>> atomic_lazy_int_after(io_event &ev, int x)
+  {
+    co_await ev;
+    co_return x;
+  }
+  inline atomic_lazy<result<int>> atomic_sum(atomic_eager<result<int>> a, atomic_lazy<result<int>> b)
+  {
+    OUTCOME_CO_TRY(auto x, co_await std::move(a));
+    OUTCOME_CO_TRY(auto y, co_await std::move(b));
+    co_return x + y;
+  }
+
   inline eager<int> eager_int2(int x) { co_return x + 1; }
   inline lazy<int> lazy_int2(int x) { co_return x + 1; }
   inline eager<void> eager_void2() { co_return; }
   inline lazy<void> lazy_void2() { co_return; }
+  inline lazy<result<int>> when_all_void(eager<void> a, eager<result<int>> b, lazy<void> c)
+  {
+    OUTCOME_CO_TRY(auto &&v, co_await OUTCOME_V2_NAMESPACE::awaitables::when_all(std::move(a), std::move(b), std::move(c)));
+    co_return std::get<1>(v);
+  }
+  inline lazy<void> when_any_void(lazy<void> a, lazy<void> b) { co_await OUTCOME_V2_NAMESPACE::awaitables::when_any(std::move(a), std::move(b)); }
 }  // namespace coroutines
 
 BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / eager_lazy, "Tests that results are eager and lazy awaitable")
@@ -142,6 +282,53 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / eager_lazy, "Tests that results
   ensure_coroutine_needs_resuming_once(lazy_void2());
 }
 
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / atomic_eager_lazy, "Tests that atomic awaitables hand off completion whether or not they suspended")
+{
+  using namespace coroutines;
+  auto start = [](auto &t)
+  {
+    BOOST_CHECK(!t.await_ready());
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  };
+  {
+    // Eager coroutine never suspends, so needs no synchronised handoff
+    io_event ev;
+    auto t = atomic_sum(atomic_eager_int(5), atomic_lazy_int_after(ev, 3));
+    start(t);
+    BOOST_CHECK(!t.await_ready());
+    ev.signal();
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 9);
+  }
+  {
+    // Eager coroutine suspends, and completes after its awaiter has suspended
+    io_event ev1, ev2;
+    auto t = atomic_sum(atomic_eager_int_after(ev1, 5), atomic_lazy_int_after(ev2, 3));
+    start(t);
+    BOOST_CHECK(!t.await_ready());
+    ev1.signal();
+    BOOST_CHECK(!t.await_ready());
+    ev2.signal();
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 8);
+  }
+  {
+    // Eager coroutine suspends, and completes before it is awaited
+    io_event ev1, ev2;
+    auto t = atomic_sum(atomic_eager_int_after(ev1, 5), atomic_lazy_int_after(ev2, 3));
+    ev1.signal();
+    start(t);
+    BOOST_CHECK(!t.await_ready());
+    ev2.signal();
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 8);
+  }
+}
+
 BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / generator, "Tests that results can be generated")
 {
   using namespace coroutines;
@@ -185,6 +372,205 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / generator, "Tests that results
   BOOST_CHECK_THROW(check_generator(generator_exception(e)).value(), custom_exception_type);
 #endif
 }
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / async_generator, "Tests that results can be generated asynchronously")
+{
+  using namespace coroutines;
+  auto start = [](auto &t)
+  {
+    BOOST_CHECK(!t.await_ready());  // lazy consumer must not have begun
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  };
+  {
+    io_event ev;
+    auto t = async_generator_sum(async_generator_int(ev, 5));
+    start(t);
+    BOOST_CHECK(!t.await_ready());  // producer is suspended awaiting i/o
+    ev.signal();
+    BOOST_CHECK(!t.await_ready());
+    ev.signal();
+    BOOST_REQUIRE(t.await_ready());  // producer finished, which resumed the consumer
+    BOOST_CHECK(t.await_resume().value() == 18);
+  }
+  {
+    int produced = 0;
+    auto t = async_generator_sum(async_generator_error(produced, 5));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+    BOOST_CHECK(produced == 2);
+  }
+  {
+    // The failure is delivered, then the producer is never resumed again
+    int produced = 0;
+    auto t = async_generator_count(async_generator_error(produced, 5));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume() == 2);
+    BOOST_CHECK(produced == 2);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / when_all_any, "Tests that results can be awaited concurrently")
+{
+  using namespace coroutines;
+  auto start = [](auto &t)
+  {
+    BOOST_CHECK(!t.await_ready());
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  };
+  {
+    // Void results become void_type in the tuple, and are otherwise ignored
+    auto t = when_all_sum(eager_int(1), lazy_int(2), lazy_void2_result());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 5);
+  }
+  {
+    // Both children are in flight at the same time
+    io_event ev1, ev2;
+    auto t = when_all_sum(lazy_int_after(ev1, 3), lazy_int_after(ev2, 4));
+    start(t);
+    BOOST_CHECK(ev1.waiter && ev2.waiter);
+    ev2.signal();
+    BOOST_CHECK(!t.await_ready());
+    ev1.signal();
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 7);
+  }
+  {
+    // An already failed child means later lazy children are never started
+    int started = 0;
+    auto t = when_all_sum(eager_error(), lazy_int_counted(started, 2), lazy_void2_result());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+    BOOST_CHECK(started == 0);
+  }
+  {
+    // First success wins, and later lazy children are never started
+    int started = 0;
+    auto t = when_any_of(lazy_error_counted(started), lazy_int_counted(started, 6), lazy_int_counted(started, 7));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 6);
+    BOOST_CHECK(started == 2);
+  }
+  {
+    int started = 0;
+    auto t = when_any_of(lazy_error_counted(started), lazy_error_counted(started), lazy_error_counted(started));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+    BOOST_CHECK(started == 3);
+  }
+  using OUTCOME_V2_NAMESPACE::awaitables::when_all;
+  using OUTCOME_V2_NAMESPACE::awaitables::when_any;
+  {
+    // If every child has already completed, the group is ready without being suspended
+    auto t = when_all(eager_int(1), eager_int(2));
+    BOOST_REQUIRE(t.await_ready());
+    auto r = t.await_resume();
+    BOOST_REQUIRE(r.has_value());
+    BOOST_CHECK(std::get<0>(r.value()) == 2);
+    BOOST_CHECK(std::get<1>(r.value()) == 3);
+  }
+  {
+    auto t = when_all(eager_int(1), eager_error());
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+  }
+  {
+    auto t = when_any(eager_error(), eager_int(4));
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 5);
+  }
+  {
+    auto t = when_any(eager_error(), eager_error());
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+  }
+  {
+    // Children returning void cannot fail, and become void_type in the tuple
+    auto t = when_all_void(eager_void2(), eager_int(1), lazy_void2());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 2);
+  }
+  {
+    auto t = when_all(eager_void2(), eager_error());
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+  }
+  {
+    auto t = when_any_void(lazy_void2(), lazy_void2());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    t.await_resume();
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / cancellation, "Tests that failure within a when_all() group cancels its siblings")
+{
+  using namespace coroutines;
+  auto start = [](auto &t)
+  {
+    BOOST_CHECK(!t.await_ready());
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  };
+  {
+    // Once a sibling fails, a lazy awaitable is canceled at its first suspension point rather than started
+    io_event ev1, ev2;
+    int started = 0;
+    auto t = when_all_sum(lazy_int_after_then_child(ev1, started), lazy_error_after(ev2));
+    start(t);
+    ev2.signal();
+    BOOST_CHECK(!t.await_ready());  // first child is still in flight
+    ev1.signal();
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);  // the first failure wins
+    BOOST_CHECK(started == 0);
+  }
+  {
+    // Without a failure, nothing is canceled
+    io_event ev1, ev2;
+    int started = 0;
+    auto t = when_all_sum(lazy_int_after_then_child(ev1, started), lazy_int_after(ev2, 2));
+    start(t);
+    ev2.signal();
+    ev1.signal();
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 3);
+    BOOST_CHECK(started == 1);
+  }
+  {
+    // Stop tokens can be polled
+    io_event ev1, ev2;
+    auto t = when_all_sum(lazy_stop_requested_after(ev1), lazy_error_after(ev2));
+    start(t);
+    ev2.signal();
+    ev1.signal();
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+  }
+  {
+    auto t = stop_not_possible();
+    start(t);
+    BOOST_CHECK(t.await_ready());
+  }
+}
 #else
 int main(void)
 {
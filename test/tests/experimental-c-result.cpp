@@ -71,7 +71,25 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result, "Tests that the C r
     BOOST_CHECK(outcome_status_code_equal_generic(&l.error, EFAULT));
     std::cout << outcome_status_code_message(&l.error) << std::endl;
     BOOST_CHECK(0 == strcmp(outcome_status_code_message(&l.error), "Bad address"));
+    // Messages of errno codes are cached per thread, so stay valid across other lookups
+    const char *msg = outcome_status_code_message(&l.error);
+    result_custom l3(outcome_make_result_system_test_failure_posix((int) errc::invalid_argument));
+    BOOST_CHECK(0 == strcmp(outcome_status_code_message(&l3.error), "Invalid argument"));
+    BOOST_CHECK(msg == outcome_status_code_message(&l2.error));
+    BOOST_CHECK(0 == strcmp(msg, "Bad address"));
   }
+#ifndef _WIN32
+  {  // inline C construction matches C++ construction
+    result_custom l(outcome_make_result_system_test_failure_system(EINVAL));
+    result_custom l2(to_system_test(result<custom_value_type>(posix_code(EINVAL))));
+    BOOST_CHECK(l.flags == l2.flags);
+    BOOST_CHECK(l.error.value == l2.error.value);
+    BOOST_CHECK(outcome_status_code_equal(&l.error, &l2.error));
+    result<custom_value_type> m(to_result(l));
+    BOOST_CHECK(m.has_error());
+    BOOST_CHECK(m.error() == errc::invalid_argument);
+  }
+#endif
   {  // valued
     result_custom l(outcome_make_result_system_test_success(shouldbe));
     result<custom_value_type> m(to_result(l));
@@ -142,18 +160,21 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result, "Tests that the C r
   }
   // C try with cleanup on failure
   {
+    int cleanups = 0;
     auto will_succeed = [&]() -> result_custom { return outcome_make_result_system_test_success(shouldbe); };
     auto will_fail = [&]() -> result_custom { return outcome_make_result_system_test_failure_posix((int) errc::bad_address); };
     auto test = [&](result_custom r) -> result_custom
     {
-      CXX_RESULT_SYSTEM_TRY(printf("failed!\n"), r);
+      CXX_RESULT_SYSTEM_TRY(++cleanups, r);
       return will_succeed();
     };
     auto r1 = test(will_succeed());
     BOOST_CHECK(CXX_RESULT_HAS_VALUE(r1));
     BOOST_CHECK(0 == memcmp(r1.value.v, shouldbe.v, sizeof(shouldbe.v)));
+    BOOST_CHECK(cleanups == 0);
     auto r2 = test(will_fail());
     BOOST_CHECK(CXX_RESULT_HAS_ERROR(r2));
+    BOOST_CHECK(cleanups == 1);
     BOOST_CHECK(outcome_status_code_equal_generic(&r2.error, EFAULT));
   }
   // C try with cleanup and success output
@@ -188,6 +209,53 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result, "Tests that the C r
     BOOST_CHECK(CXX_RESULT_HAS_ERROR(r2));
     BOOST_CHECK(outcome_status_code_equal_generic(&r2.error, EFAULT));
   }
+  // C try with a chain of cleanup labels
+  {
+    int acquired = 0, released = 0;
+    auto acquire = [&](int n, int fail) -> result_custom
+    {
+      if(n == fail)
+      {
+        return outcome_make_result_system_test_failure_posix((int) errc::not_enough_memory);
+      }
+      ++acquired;
+      return outcome_make_result_system_test_success(shouldbe);
+    };
+    auto test = [&](int fail) -> result_custom
+    {
+      result_custom ret = outcome_make_result_system_test_success(shouldbe);
+      custom_value_type v;
+      CXX_RESULT_SYSTEM_TRY_GOTO(ret, fail0, acquire(0, fail));
+      CXX_RESULT_SYSTEM_TRY_GOTO(v, ret, fail1, acquire(1, fail));
+      CXX_RESULT_SYSTEM_TRY_GOTO(ret.value, ret, fail2, acquire(2, fail));
+      ret.value.v[0] = v.v[0] + 1;
+      ++released;
+    fail2:
+      ++released;
+    fail1:
+      ++released;
+    fail0:
+      return ret;
+    };
+    for(int fail = 0; fail < 4; fail++)
+    {
+      acquired = released = 0;
+      auto r = test(fail);
+      BOOST_CHECK(acquired == ((fail < 3) ? fail : 3));
+      BOOST_CHECK(released == acquired);
+      if(fail < 3)
+      {
+        BOOST_CHECK(CXX_RESULT_HAS_ERROR(r));
+        BOOST_CHECK(outcome_status_code_equal_generic(&r.error, ENOMEM));
+      }
+      else
+      {
+        BOOST_REQUIRE(CXX_RESULT_HAS_VALUE(r));
+        BOOST_CHECK(r.value.v[0] == shouldbe.v[0] + 1);
+        BOOST_CHECK(0 == memcmp(r.value.v + 1, shouldbe.v + 1, sizeof(shouldbe.v) - sizeof(shouldbe.v[0])));
+      }
+    }
+  }
 }
 #else
 int main(void)
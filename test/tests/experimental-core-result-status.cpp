@@ -355,3 +355,39 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / result, "Tests that the resul
   }
 #endif
 }
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / errno_flag, "Tests that results of errno status codes compare by errno value")
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  using OUTCOME_V2_NAMESPACE::failure;
+  // Typed and erased errno codes know they are errno
+  result<int, posix_code> a(posix_code(ENOENT));
+  result<int, generic_code> b(errc::no_such_file_or_directory);
+  result<int> c(posix_code(ENOENT)), d(generic_code(errc::invalid_argument)), e(5);
+  BOOST_CHECK(a.error_is_errno(ENOENT));
+  BOOST_CHECK(!a.error_is_errno(EINVAL));
+  BOOST_CHECK(b.error_is_errno(ENOENT));
+  BOOST_CHECK(c.error_is_errno(ENOENT));
+  BOOST_CHECK(d.error_is_errno(EINVAL));
+  BOOST_CHECK(!e.error_is_errno(0));
+  // Comparisons give the same answers as semantic equivalence
+  BOOST_CHECK(a == b);
+  BOOST_CHECK(!(a != b));
+  BOOST_CHECK(a == c);
+  BOOST_CHECK(c != d);
+  BOOST_CHECK(!(c == d));
+  BOOST_CHECK(c == failure(errc::no_such_file_or_directory));
+  BOOST_CHECK(c != failure(errc::invalid_argument));
+  BOOST_CHECK(d == failure(generic_code(errc::invalid_argument)));
+  BOOST_CHECK(c != e);
+  // Moves and conversions preserve errno-ness
+  result<int> f(std::move(a));
+  BOOST_CHECK(f.error_is_errno(ENOENT));
+  BOOST_CHECK(f == b);
+#ifdef __cpp_exceptions
+  // Codes whose values are not integers still compare semantically
+  result<int, status_code_payload> g{payload{errc::invalid_argument, "niall"}}, h{payload{errc::invalid_argument, "douglas"}};
+  BOOST_CHECK(g == h);
+  BOOST_CHECK(g == failure(errc::invalid_argument));
+#endif
+}
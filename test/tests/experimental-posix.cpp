@@ -0,0 +1,116 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef _WIN32
+
+#include "../../include/outcome/experimental/posix.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+
+// Exposes the have_error_is_errno status bit
+struct errno_probe : OUTCOME_V2_NAMESPACE::policy::base
+{
+  template <class R> static bool error_is_errno(const R &r) noexcept { return _has_error_is_errno(r); }
+};
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / posix, "Tests that the POSIX syscall wrappers work as intended")
+{
+  namespace posix = OUTCOME_V2_NAMESPACE::experimental::posix;
+  using OUTCOME_V2_NAMESPACE::experimental::errc;
+
+  // Failures carry errno and say so
+  {
+    auto r = posix::open("shouldneverexistnotever", O_RDONLY);
+    BOOST_REQUIRE(r.has_error());
+    BOOST_CHECK(r.error() == errc::no_such_file_or_directory);
+    BOOST_CHECK(r.error().value() == ENOENT);
+    BOOST_CHECK(errno_probe::error_is_errno(r));
+    auto r2 = posix::close(-1);
+    BOOST_REQUIRE(r2.has_error());
+    BOOST_CHECK(r2.error() == errc::bad_file_descriptor);
+    BOOST_CHECK(errno_probe::error_is_errno(r2));
+  }
+  // Interrupted syscalls are retried
+  {
+    int calls = 0;
+    auto ret = posix::detail::retry_on_eintr(
+    [&]
+    {
+      if(++calls < 3)
+      {
+        errno = EINTR;
+        return -1;
+      }
+      return 5;
+    });
+    BOOST_CHECK(ret == 5);
+    BOOST_CHECK(calls == 3);
+    calls = 0;
+    ret = posix::detail::retry_on_eintr(
+    [&]
+    {
+      ++calls;
+      errno = EAGAIN;
+      return -1;
+    });
+    BOOST_CHECK(ret == -1);
+    BOOST_CHECK(calls == 1);
+  }
+  // A round trip through a file
+  {
+    static const char path[] = "outcome-experimental-posix.tmp";
+    auto fd = posix::open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    BOOST_REQUIRE(fd.has_value());
+    BOOST_CHECK(!errno_probe::error_is_errno(fd));
+    BOOST_CHECK(posix::write(fd.value(), "hello ", 6).value() == 6);
+    char world[] = "world", bang[] = "!";
+    struct iovec iov[2] = {{world, 5}, {bang, 1}};
+    BOOST_CHECK(posix::pwritev(fd.value(), iov, 2, 6).value() == 6);
+    BOOST_CHECK(posix::fsync(fd.value()).has_value());
+    char buffer[16] = {};
+    BOOST_CHECK(posix::pread(fd.value(), buffer, sizeof(buffer), 0).value() == 12);
+    BOOST_CHECK(0 == strcmp(buffer, "hello world!"));
+    auto *mapped = posix::mmap(nullptr, 12, PROT_READ, MAP_SHARED, fd.value(), 0).value();
+    BOOST_CHECK(0 == memcmp(mapped, "hello world!", 12));
+    BOOST_CHECK(posix::munmap(mapped, 12).has_value());
+    BOOST_CHECK(posix::ftruncate(fd.value(), 5).has_value());
+    memset(buffer, 0, sizeof(buffer));
+    BOOST_CHECK(posix::read(fd.value(), buffer, sizeof(buffer)).value() == 0);  // at end
+    BOOST_CHECK(posix::pread(fd.value(), buffer, sizeof(buffer), 0).value() == 5);
+    BOOST_CHECK(0 == strcmp(buffer, "hello"));
+    BOOST_CHECK(posix::close(fd.value()).has_value());
+    auto r = posix::read(fd.value(), buffer, sizeof(buffer));
+    BOOST_REQUIRE(r.has_error());
+    BOOST_CHECK(r.error() == errc::bad_file_descriptor);
+    ::unlink(path);
+  }
+}
+
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,65 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define OUTCOME_ENABLE_FAILURE_EXCEPTION_CACHE 1
+#define OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES 8
+
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_outcome_failure_exception_cache, "Tests that failure() reuses the exception synthesised for an error code")
+{
+#ifdef __cpp_exceptions
+  using namespace OUTCOME_V2_NAMESPACE;
+  auto code_of = [](const std::exception_ptr &e) -> std::error_code {
+    try
+    {
+      std::rethrow_exception(e);
+    }
+    catch(const std::system_error &ex)
+    {
+      return ex.code();
+    }
+  };
+  outcome<int> a(std::errc::invalid_argument), b(std::errc::invalid_argument), c(std::errc::no_such_file_or_directory);
+  const std::exception_ptr ea = a.failure();
+  BOOST_CHECK(code_of(ea) == std::errc::invalid_argument);
+  BOOST_CHECK(code_of(c.failure()) == std::errc::no_such_file_or_directory);
+  // The same error code gets the same exception, different error codes do not
+  BOOST_CHECK(a.failure() == ea);
+  BOOST_CHECK(b.failure() == ea);
+  BOOST_CHECK(c.failure() != ea);
+  // An exception stored in the outcome is still preferred
+  outcome<int> d(std::make_error_code(std::errc::invalid_argument), std::make_exception_ptr(std::runtime_error("d")));
+  BOOST_CHECK(d.failure() != ea);
+
+  // More error codes than fit into the cache are still synthesised correctly
+  for(int n = 1; n < 4 * OUTCOME_FAILURE_EXCEPTION_CACHE_ENTRIES; n++)
+  {
+    outcome<int> e(std::error_code(n, std::system_category()));
+    BOOST_CHECK(code_of(e.failure()) == std::error_code(n, std::system_category()));
+    BOOST_CHECK(code_of(e.failure()) == std::error_code(n, std::system_category()));
+  }
+  BOOST_CHECK(a.failure() == ea);
+#endif
+}
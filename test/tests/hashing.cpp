@@ -0,0 +1,99 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_outcome_hash, "Tests that result and outcome can be hashed")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  struct udt
+  {
+  };
+  static_assert(std::is_default_constructible<std::hash<result<int>>>::value, "");
+  static_assert(std::is_default_constructible<std::hash<result<void>>>::value, "");
+  static_assert(std::is_default_constructible<std::hash<outcome<std::string>>>::value, "");
+  static_assert(!std::is_default_constructible<std::hash<result<udt>>>::value, "");
+  static_assert(!std::is_default_constructible<std::hash<result<int, udt>>>::value, "");
+  static_assert(!std::is_default_constructible<std::hash<success_type<udt>>>::value, "");
+
+  const std::error_code enoent = std::make_error_code(std::errc::no_such_file_or_directory), einval = std::make_error_code(std::errc::invalid_argument);
+  {
+    // Equal results hash the same, and a value and an error which happen to hash the same do not
+    std::hash<result<int>> h;
+    BOOST_CHECK(h(result<int>(5)) == h(result<int>(5)));
+    BOOST_CHECK(h(result<int>(5)) != h(result<int>(6)));
+    BOOST_CHECK(h(result<int>(enoent)) == h(result<int>(enoent)));
+    BOOST_CHECK(h(result<int>(enoent)) != h(result<int>(einval)));
+    BOOST_CHECK(h(result<int>(std::hash<std::error_code>()(enoent))) != h(result<int>(enoent)));
+    BOOST_CHECK(std::hash<result<void>>()(success()) != std::hash<result<void>>()(enoent));
+  }
+  {
+    // success_type and failure_type hash the same as the results they compare equal to
+    result_hash h;
+    BOOST_CHECK(h(result<std::string>("hello")) == h(success(std::string("hello"))));
+    BOOST_CHECK(h(result<std::string>(enoent)) == h(failure(enoent)));
+    BOOST_CHECK(h(result<void>(success())) == h(success()));
+    BOOST_CHECK(std::hash<failure_type<std::error_code>>()(failure(enoent)) == h(failure(enoent)));
+    BOOST_CHECK(h(outcome<int>(5)) == h(success(5)));
+    BOOST_CHECK(h(outcome<int>(enoent)) == h(failure(enoent)));
+  }
+  {
+    // Negative result caching
+    std::unordered_map<std::string, result<int>> lookups;
+    lookups.emplace("a", 1);
+    lookups.emplace("b", enoent);
+    std::unordered_map<result<int>, std::string, result_hash, std::equal_to<>> reverse;
+    for(auto &i : lookups)
+    {
+      reverse.emplace(i.second, i.first);
+    }
+    BOOST_CHECK(reverse.size() == 2);
+    BOOST_CHECK(reverse.at(result<int>(1)) == "a");
+    BOOST_CHECK(reverse.at(result<int>(enoent)) == "b");
+#ifdef __cpp_lib_generic_unordered_lookup
+    // Heterogeneous lookup, without constructing a result
+    BOOST_CHECK(reverse.find(success(1))->second == "a");
+    BOOST_CHECK(reverse.find(failure(enoent))->second == "b");
+    BOOST_CHECK(reverse.find(failure(einval)) == reverse.end());
+#endif
+  }
+#ifdef __cpp_exceptions
+  {
+    // Outcomes with an error hash by the error alone, as they compare equal to outcomes with only that error
+    std::hash<outcome<int>> h;
+    auto e = std::make_exception_ptr(std::runtime_error("hello"));
+    BOOST_CHECK(outcome<int>(enoent, e) == outcome<int>(enoent));
+    BOOST_CHECK(h(outcome<int>(enoent, e)) == h(outcome<int>(enoent)));
+    BOOST_CHECK(h(outcome<int>(e)) == h(outcome<int>(e)));
+    BOOST_CHECK(h(outcome<int>(e)) != h(outcome<int>(enoent)));
+    std::unordered_set<outcome<int>> s{outcome<int>(1), outcome<int>(enoent), outcome<int>(e)};
+    BOOST_CHECK(s.size() == 3);
+    BOOST_CHECK(s.count(outcome<int>(enoent, e)) == 1);
+  }
+#endif
+}
@@ -0,0 +1,145 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define OUTCOME_ENABLE_OVERLAPPED_EXCEPTION_STORAGE 1
+
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <memory>
+#include <string>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_outcome_overlapped_exception_storage, "Tests that outcome stores its exception within the value's storage when enabled")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  // Where value and error already share storage, there is nothing to gain
+  static_assert(!detail::outcome_exception_overlaps_value<int, std::error_code, std::exception_ptr>, "");
+  static_assert(!detail::outcome_exception_overlaps_value<void, std::error_code, std::exception_ptr>, "");
+  static_assert(!detail::outcome_exception_overlaps_value<char, std::string, std::exception_ptr>, "");
+  static_assert(detail::outcome_exception_overlaps_value<std::string, std::error_code, std::exception_ptr>, "");
+  static_assert(detail::outcome_exception_overlaps_value<std::unique_ptr<int>, std::error_code, std::exception_ptr>, "");
+  static_assert(sizeof(outcome<std::string>) < sizeof(std::string) + sizeof(std::error_code) + sizeof(std::exception_ptr) + sizeof(void *), "");
+  static_assert(sizeof(outcome<std::string>) == sizeof(result<std::string>), "");
+  static_assert(sizeof(outcome<std::unique_ptr<int>>) == sizeof(result<std::unique_ptr<int>>), "");
+  static_assert(!std::is_copy_constructible<outcome<std::unique_ptr<int>>>::value, "");
+  static_assert(std::is_nothrow_move_constructible<outcome<std::unique_ptr<int>>>::value, "");
+
+#ifdef __cpp_exceptions
+  auto eptr = [](int v) { return std::make_exception_ptr(std::runtime_error(std::to_string(v))); };
+  auto what = [](const std::exception_ptr &e) -> std::string {
+    try
+    {
+      std::rethrow_exception(e);
+    }
+    catch(const std::exception &ex)
+    {
+      return ex.what();
+    }
+  };
+  using outcome_type = outcome<std::string>;
+  {
+    // Construction and observation
+    outcome_type a("hello"), b(eptr(1)), c(std::make_error_code(std::errc::invalid_argument), eptr(2));
+    BOOST_CHECK(a.has_value());
+    BOOST_CHECK(!a.has_exception());
+    BOOST_CHECK(a.value() == "hello");
+    BOOST_CHECK(b.has_exception() && !b.has_error());
+    BOOST_CHECK(what(b.exception()) == "1");
+    BOOST_CHECK(c.has_exception() && c.has_error());
+    BOOST_CHECK(what(c.exception()) == "2");
+    BOOST_CHECK(c.error() == std::errc::invalid_argument);
+    BOOST_CHECK_THROW(b.value(), std::runtime_error);
+
+    // Copy and move, both construction and assignment
+    outcome_type d(a), e(b), f(std::move(c));
+    BOOST_CHECK(d.value() == "hello");
+    BOOST_CHECK(what(e.exception()) == "1");
+    BOOST_CHECK(what(f.exception()) == "2");
+    d = e;
+    BOOST_CHECK(!d.has_value() && what(d.exception()) == "1");
+    d = a;
+    BOOST_CHECK(d.value() == "hello");
+    e = std::move(f);
+    BOOST_CHECK(what(e.exception()) == "2" && e.has_error());
+    f = outcome_type("world");
+    BOOST_CHECK(f.value() == "world");
+
+    // Comparison
+    BOOST_CHECK(a == d);
+    BOOST_CHECK(b != e);
+    BOOST_CHECK(b == outcome_type(b.exception()));
+
+    // Swap every combination of value and exception
+    a.swap(b);
+    BOOST_CHECK(what(a.exception()) == "1");
+    BOOST_CHECK(b.value() == "hello");
+    a.swap(e);
+    BOOST_CHECK(what(a.exception()) == "2" && a.has_error());
+    BOOST_CHECK(what(e.exception()) == "1" && !e.has_error());
+    b.swap(f);
+    BOOST_CHECK(b.value() == "world" && f.value() == "hello");
+    using std::swap;
+    swap(a, f);
+    BOOST_CHECK(a.value() == "hello");
+    BOOST_CHECK(what(f.exception()) == "2");
+  }
+  {
+    // Move only value types
+    outcome<std::unique_ptr<int>> a(std::make_unique<int>(5)), b(eptr(3));
+    a = std::move(b);
+    BOOST_CHECK(what(a.exception()) == "3");
+    b = std::make_unique<int>(6);
+    swap(a, b);
+    BOOST_CHECK(*a.value() == 6);
+    BOOST_CHECK(what(b.exception()) == "3");
+  }
+  {
+    // Conversion from result and from other outcomes
+    result<const char *> r("hi");
+    outcome_type a(r);
+    BOOST_CHECK(a.value() == "hi");
+    outcome<const char *> b(eptr(4));
+    outcome_type c(b);
+    BOOST_CHECK(what(c.exception()) == "4");
+    outcome_type d(failure(std::make_error_code(std::errc::invalid_argument), eptr(5)));
+    BOOST_CHECK(d.has_error() && what(d.exception()) == "5");
+    // From an outcome whose exception overlaps a value, which must not be read as an exception
+    using narrow_type = basic_outcome<std::string, std::error_code, std::exception_ptr, policy::all_narrow>;
+    outcome_type e("hello"), f(eptr(8));
+    narrow_type g(e), h(f), i(std::move(e)), j(std::move(f));
+    BOOST_CHECK(g.has_value() && !g.has_exception() && g.value() == "hello");
+    BOOST_CHECK(i.has_value() && !i.has_exception() && i.value() == "hello");
+    BOOST_CHECK(what(h.exception()) == "8");
+    BOOST_CHECK(what(j.exception()) == "8");
+  }
+  {
+    // Overriding the exception of a valued outcome replaces the value
+    outcome_type a("hello");
+    hooks::override_outcome_exception(&a, eptr(6));
+    BOOST_CHECK(!a.has_value());
+    BOOST_CHECK(what(a.exception()) == "6");
+    hooks::override_outcome_exception(&a, eptr(7));
+    BOOST_CHECK(what(a.exception()) == "7");
+  }
+#endif
+}
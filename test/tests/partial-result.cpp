@@ -0,0 +1,169 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/partial_result.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+#include <vector>
+
+namespace partial_result_test
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+
+  // Writes the items, of which those which are negative fail, returning how many were written
+  inline partial_result<size_t> write_batch(const std::vector<int> &items)
+  {
+    if(items.empty())
+    {
+      return std::errc::invalid_argument;
+    }
+    partial_result<size_t> ret(size_t(0));
+    for(size_t n = 0; n < items.size(); n++)
+    {
+      if(items[n] < 0)
+      {
+        ret.add_failure(n, make_error_code(std::errc::io_error));
+      }
+      else
+      {
+        ret.assume_value()++;
+      }
+    }
+    if(ret.assume_value() == 0)
+    {
+      // Every item failed, so fail the batch, keeping which items failed
+      return {failure(std::errc::io_error), std::move(ret).failures()};
+    }
+    return ret;
+  }
+
+  inline result<size_t> write_twice(const std::vector<int> &items)
+  {
+    OUTCOME_TRY(auto written, write_batch(items));
+    OUTCOME_TRY(auto again, write_batch(items));
+    return written + again;
+  }
+}  // namespace partial_result_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_partial_result, "Tests that partial_result carries a value and the failures of items")
+{
+  using namespace partial_result_test;
+  {
+    auto r = write_batch({1, 2, 3});
+    BOOST_CHECK(r.has_value());
+    BOOST_CHECK(r);
+    BOOST_CHECK(!r.has_failures());
+    BOOST_CHECK(r.value() == 3);
+    BOOST_CHECK(r.failures().empty());
+  }
+  {
+    // Few failures are stored within the partial_result
+    auto r = write_batch({1, -2, 3, -4});
+    BOOST_CHECK(r.has_value());
+    BOOST_CHECK(r.has_failures());
+    BOOST_CHECK(r.value() == 2);
+    BOOST_REQUIRE(r.failures().size() == 2);
+    BOOST_CHECK(r.failures()[0].index == 1);
+    BOOST_CHECK(r.failures()[1].index == 3);
+    BOOST_CHECK(r.failures()[1].error == std::errc::io_error);
+    BOOST_CHECK(r.failures().capacity() == partial_result<size_t>::inline_failures);
+    const void *data = r.failures().data();
+    BOOST_CHECK(data >= static_cast<const void *>(&r) && data < static_cast<const void *>(&r + 1));
+  }
+  {
+    // More are stored in an allocation, which moves steal
+    std::vector<int> items;
+    for(int n = 0; n < 20; n++)
+    {
+      items.push_back((n % 2 == 0) ? n : -n);
+    }
+    auto r = write_batch(items);
+    BOOST_CHECK(r.value() == 10);
+    BOOST_REQUIRE(r.failures().size() == 10);
+    for(size_t n = 0; n < 10; n++)
+    {
+      BOOST_CHECK(r.failures()[n].index == n * 2 + 1);
+    }
+    auto copy(r);
+    BOOST_CHECK(copy.failures().size() == 10);
+    BOOST_CHECK(copy.failures().data() != r.failures().data());
+    const auto *data = r.failures().data();
+    auto moved(std::move(r));
+    BOOST_CHECK(moved.failures().data() == data);
+    BOOST_CHECK(moved.failures()[9].index == 19);
+    moved.clear_failures();
+    BOOST_CHECK(!moved.has_failures());
+    moved = copy;
+    BOOST_CHECK(moved.failures().size() == 10);
+  }
+  {
+    // Total failure still reports which items failed
+    auto r = write_batch({-1, -2});
+    BOOST_CHECK(!r.has_value());
+    BOOST_CHECK(r.has_error());
+    BOOST_CHECK(r.error() == std::errc::io_error);
+    BOOST_CHECK(r.failures().size() == 2);
+#ifdef __cpp_exceptions
+    BOOST_CHECK_THROW(r.value(), std::system_error);
+#endif
+    BOOST_CHECK(write_batch({}).error() == std::errc::invalid_argument);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_partial_result_try, "Tests that OUTCOME_TRY propagates only the total failure of a partial_result")
+{
+  using namespace partial_result_test;
+  BOOST_CHECK(write_twice({1, 2}).value() == 4);
+  BOOST_CHECK(write_twice({1, -2, 3}).value() == 4);
+  BOOST_CHECK(write_twice({-1, -2}).error() == std::errc::io_error);
+  BOOST_CHECK(write_twice({}).error() == std::errc::invalid_argument);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_partial_result_void, "Tests that partial_result works with void values and non-trivial errors")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  partial_result<void, std::string, 2> r(success());
+  BOOST_CHECK(r.has_value());
+  r.value();
+  for(size_t n = 0; n < 5; n++)
+  {
+    r.add_failure(n, "item " + std::to_string(n) + " was not written because of a rather long reason");
+  }
+  BOOST_REQUIRE(r.failures().size() == 5);
+  BOOST_CHECK(r.failures().capacity() >= 5);
+  BOOST_CHECK(r.failures()[4].error.substr(0, 6) == "item 4");
+  partial_result<void, std::string, 2> s(failure(std::string("everything failed")));
+  s.add_failure(0, "first");
+  s = std::move(r);
+  BOOST_CHECK(s.has_value());
+  BOOST_CHECK(s.failures().size() == 5);
+  partial_result<void, std::string, 2> t(failure(std::string("everything failed")));
+  t.add_failure(0, "first");
+  s = t;
+  BOOST_CHECK(s.error() == "everything failed");
+  BOOST_REQUIRE(s.failures().size() == 1);
+  BOOST_CHECK(s.failures()[0].error == "first");
+  BOOST_CHECK(std::move(s).as_result().error() == "everything failed");
+}
@@ -0,0 +1,137 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/result_cache.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_result_cache, "Tests that result_cache caches successes and failures with separate lifetimes")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using cache_type = result_cache<int, std::string>;
+  int calls = 0;
+  auto lookup = [&](int key) -> result<std::string> {
+    ++calls;
+    if(key < 0)
+    {
+      return std::errc::no_such_file_or_directory;
+    }
+    return std::to_string(key);
+  };
+  {
+    cache_type cache(64, std::chrono::hours(1), std::chrono::hours(1));
+    BOOST_CHECK(cache.get_or_compute(5, [&] { return lookup(5); }).value() == "5");
+    BOOST_CHECK(cache.get_or_compute(5, [&] { return lookup(5); }).value() == "5");
+    BOOST_CHECK(calls == 1);
+    // Failures are cached too
+    BOOST_CHECK(cache.get_or_compute(-1, [&] { return lookup(-1); }).error() == std::errc::no_such_file_or_directory);
+    BOOST_CHECK(cache.get_or_compute(-1, [&] { return lookup(-1); }).error() == std::errc::no_such_file_or_directory);
+    BOOST_CHECK(calls == 2);
+    BOOST_CHECK(cache.size() == 2);
+    BOOST_CHECK(cache.stats().hits == 2);
+    BOOST_CHECK(cache.stats().misses == 2);
+    BOOST_CHECK(cache.invalidate(5));
+    BOOST_CHECK(!cache.invalidate(5));
+    BOOST_CHECK(cache.get_or_compute(5, [&] { return lookup(5); }).value() == "5");
+    BOOST_CHECK(calls == 3);
+    cache.clear();
+    BOOST_CHECK(cache.size() == 0);
+  }
+  {
+    // Failures expire independently of successes, and a zero lifetime is never cached
+    calls = 0;
+    cache_type cache(64, std::chrono::hours(1), std::chrono::milliseconds(1));
+    (void) cache.get_or_compute(5, [&] { return lookup(5); });
+    (void) cache.get_or_compute(-1, [&] { return lookup(-1); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    (void) cache.get_or_compute(5, [&] { return lookup(5); });
+    (void) cache.get_or_compute(-1, [&] { return lookup(-1); });
+    BOOST_CHECK(calls == 3);
+
+    calls = 0;
+    cache_type uncached(64, std::chrono::hours(1), cache_type::duration::zero());
+    (void) uncached.get_or_compute(-1, [&] { return lookup(-1); });
+    (void) uncached.get_or_compute(-1, [&] { return lookup(-1); });
+    BOOST_CHECK(calls == 2);
+    BOOST_CHECK(uncached.size() == 0);
+  }
+  {
+    // The least recently used entries are evicted to stay within capacity
+    calls = 0;
+    cache_type cache(4, std::chrono::hours(1), std::chrono::hours(1), 1);
+    for(int n = 0; n < 4; n++)
+    {
+      (void) cache.get_or_compute(n, [&] { return lookup(n); });
+    }
+    (void) cache.get_or_compute(0, [&] { return lookup(0); });
+    (void) cache.get_or_compute(4, [&] { return lookup(4); });
+    BOOST_CHECK(cache.size() == 4);
+    BOOST_CHECK(cache.stats().evictions == 1);
+    (void) cache.get_or_compute(0, [&] { return lookup(0); });
+    BOOST_CHECK(calls == 5);
+    (void) cache.get_or_compute(1, [&] { return lookup(1); });
+    BOOST_CHECK(calls == 6);
+  }
+  {
+    // Concurrent misses for the same key invoke the callable once
+    cache_type cache(64, std::chrono::hours(1), std::chrono::hours(1));
+    std::atomic<int> invocations{0};
+    std::atomic<bool> release{false};
+    auto slow = [&]() -> result<std::string> {
+      ++invocations;
+      while(!release)
+      {
+        std::this_thread::yield();
+      }
+      return std::errc::no_such_file_or_directory;
+    };
+    std::vector<std::thread> threads;
+    std::vector<result<std::string>> results(8, std::string());
+    threads.emplace_back([&] { results[0] = cache.get_or_compute(1, slow); });
+    while(invocations == 0)
+    {
+      std::this_thread::yield();
+    }
+    for(size_t n = 1; n < results.size(); n++)
+    {
+      threads.emplace_back([&, n] { results[n] = cache.get_or_compute(1, slow); });
+    }
+    while(cache.stats().coalesced < results.size() - 1)
+    {
+      std::this_thread::yield();
+    }
+    release = true;
+    for(auto &i : threads)
+    {
+      i.join();
+    }
+    BOOST_CHECK(invocations == 1);
+    for(auto &i : results)
+    {
+      BOOST_CHECK(i.error() == std::errc::no_such_file_or_directory);
+    }
+  }
+}
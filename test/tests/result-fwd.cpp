@@ -0,0 +1,102 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/result_fwd.hpp"
+
+#include <memory>
+#include <string>
+
+// Only the forward declarations are available here, as in a header declaring an API
+namespace fwd
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  outcome::result<int> parse(const char *s) noexcept;
+  outcome::result<void> validate(int v) noexcept;
+  outcome::result<std::string> describe(const char *s);
+  outcome::unchecked<std::unique_ptr<int>> allocate(int v) noexcept;
+  outcome::checked<int> checked_parse(const char *s) noexcept;
+}  // namespace fwd
+
+#include "../../include/outcome/result.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+// Instantiate some result types once here, and check both macros compile
+OUTCOME_EXTERN_RESULT(int, std::error_code);
+OUTCOME_EXTERN_RESULT(void, std::error_code);
+OUTCOME_INSTANTIATE_RESULT(int, std::error_code);
+OUTCOME_INSTANTIATE_RESULT(void, std::error_code);
+OUTCOME_INSTANTIATE_RESULT(std::string, std::error_code);
+OUTCOME_INSTANTIATE_RESULT(std::unique_ptr<int>, std::error_code);
+
+namespace fwd
+{
+  outcome::result<int> parse(const char *s) noexcept
+  {
+    if(s == nullptr || *s < '0' || *s > '9')
+    {
+      return std::errc::invalid_argument;
+    }
+    return *s - '0';
+  }
+  outcome::result<void> validate(int v) noexcept
+  {
+    if(v > 5)
+    {
+      return std::errc::result_out_of_range;
+    }
+    return outcome::success();
+  }
+  outcome::result<std::string> describe(const char *s)
+  {
+    OUTCOME_TRY(auto &&v, parse(s));
+    OUTCOME_TRY(validate(v));
+    return std::to_string(v);
+  }
+  outcome::unchecked<std::unique_ptr<int>> allocate(int v) noexcept { return std::make_unique<int>(v); }
+  outcome::checked<int> checked_parse(const char *s) noexcept
+  {
+    OUTCOME_TRY(auto v, parse(s));
+    return v;
+  }
+}  // namespace fwd
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / fwd, "Tests that the forward declared result types are the result types")
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  static_assert(std::is_same<decltype(fwd::parse(nullptr)), outcome::basic_result<int, std::error_code, outcome::policy::error_code_throw_as_system_error<int, std::error_code, void>>>::value,
+                "result<int> from result_fwd.hpp is not the one from result.hpp");
+  static_assert(std::is_same<decltype(fwd::allocate(0)), outcome::basic_result<std::unique_ptr<int>, std::error_code, outcome::policy::all_narrow>>::value,
+                "unchecked<T> from result_fwd.hpp is not the one from result.hpp");
+  static_assert(std::is_same<decltype(fwd::checked_parse(nullptr)), outcome::basic_result<int, std::error_code, outcome::policy::throw_bad_result_access<std::error_code, void>>>::value,
+                "checked<T> from result_fwd.hpp is not the one from result.hpp");
+  static_assert(std::is_same<outcome::policy::default_policy<void, void, void>, outcome::policy::terminate>::value, "default_policy<void, void> is not terminate");
+
+  BOOST_CHECK(fwd::parse("3").value() == 3);
+  BOOST_CHECK(fwd::parse("x").error() == std::errc::invalid_argument);
+  BOOST_CHECK(fwd::validate(3));
+  BOOST_CHECK(fwd::describe("4").value() == "4");
+  BOOST_CHECK(fwd::describe("7").error() == std::errc::result_out_of_range);
+  BOOST_CHECK(*fwd::allocate(5).value() == 5);
+  BOOST_CHECK(fwd::checked_parse("2").value() == 2);
+}
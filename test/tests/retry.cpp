@@ -0,0 +1,175 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/result.hpp"
+#include "../../include/outcome/retry.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_retry, "Tests that retry() retries transient failures with backoff, within its limits")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  retry_policy policy;
+  policy.initial_backoff = std::chrono::microseconds(100);
+  policy.max_backoff = std::chrono::microseconds(400);
+  {
+    // Transient failures are retried until success
+    retry_counters counters;
+    policy.counters = &counters;
+    int calls = 0;
+    auto r = retry(policy, [&]() -> result<int> {
+      if(++calls < 3)
+      {
+        return std::errc::resource_unavailable_try_again;
+      }
+      return 5;
+    });
+    BOOST_CHECK(r.value() == 5);
+    BOOST_CHECK(calls == 3);
+    auto s = counters.stats();
+    BOOST_CHECK(s.calls == 1);
+    BOOST_CHECK(s.attempts == 3);
+    BOOST_CHECK(s.successes == 1);
+    BOOST_CHECK(s.backoff_ns > 0);
+  }
+  {
+    // Permanent failures are not retried, and transient ones only up to the maximum attempts
+    retry_counters counters;
+    policy.counters = &counters;
+    int calls = 0;
+    auto r = retry(policy, [&]() -> result<int> {
+      ++calls;
+      return std::errc::permission_denied;
+    });
+    BOOST_CHECK(r.error() == std::errc::permission_denied);
+    BOOST_CHECK(calls == 1);
+    calls = 0;
+    r = retry(policy, [&]() -> result<int> {
+      ++calls;
+      return std::errc::timed_out;
+    });
+    BOOST_CHECK(r.error() == std::errc::timed_out);
+    BOOST_CHECK(calls == 3);
+    // Which failures are transient is customisable
+    calls = 0;
+    r = retry(
+    policy,
+    [&]() -> result<int> {
+      ++calls;
+      return std::errc::permission_denied;
+    },
+    [](const std::error_code &ec) { return ec == std::errc::permission_denied; });
+    BOOST_CHECK(calls == 3);
+    auto s = counters.stats();
+    BOOST_CHECK(s.permanent_failures == 1);
+    BOOST_CHECK(s.attempts_exhausted == 2);
+  }
+  {
+    // Backing off past the deadline, or beyond the retry budget, gives up
+    retry_counters counters;
+    policy.counters = &counters;
+    policy.deadline = retry_policy::clock_type::now();
+    int calls = 0;
+    auto fails = [&]() -> result<int> {
+      ++calls;
+      return std::errc::connection_reset;
+    };
+    BOOST_CHECK(retry(policy, fails).error() == std::errc::connection_reset);
+    BOOST_CHECK(calls == 1);
+    policy.deadline = retry_policy::time_point::max();
+    retry_budget budget(1, 0.5);
+    policy.budget = &budget;
+    calls = 0;
+    (void) retry(policy, fails);
+    BOOST_CHECK(calls == 2);
+    BOOST_CHECK(budget.available() == 0);
+    // Successes refill the budget
+    (void) retry(policy, []() -> result<int> { return 1; });
+    (void) retry(policy, []() -> result<int> { return 1; });
+    BOOST_CHECK(budget.available() == 1);
+    (void) retry(policy, []() -> result<int> { return 1; });
+    BOOST_CHECK(budget.available() == 1);
+    auto s = counters.stats();
+    BOOST_CHECK(s.deadlines_exceeded == 1);
+    BOOST_CHECK(s.budgets_exhausted == 1);
+    policy.budget = nullptr;
+  }
+  {
+    // Backoff grows exponentially up to the maximum, less up to the jitter fraction of it
+    for(int n = 0; n < 100; n++)
+    {
+      auto b1 = policy.backoff(1), b3 = policy.backoff(3), b9 = policy.backoff(9);
+      BOOST_CHECK(b1 > std::chrono::microseconds(50) && b1 <= std::chrono::microseconds(100));
+      BOOST_CHECK(b3 > std::chrono::microseconds(200) && b3 <= std::chrono::microseconds(400));
+      BOOST_CHECK(b9 > std::chrono::microseconds(200) && b9 <= std::chrono::microseconds(400));
+    }
+  }
+}
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+namespace retry_coroutines
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+
+  // Stands in for a timer, recording how long it was asked to wait
+  struct sleep_recorder
+  {
+    std::vector<retry_policy::duration> *waits;
+    struct awaiter
+    {
+      bool await_ready() const noexcept { return true; }
+      void await_suspend(awaitables::coroutine_handle<> /*unused*/) noexcept {}
+      void await_resume() noexcept {}
+    };
+    awaiter operator()(retry_policy::duration d) const
+    {
+      waits->push_back(d);
+      return {};
+    }
+  };
+  inline awaitables::eager<result<int>> attempt(int &calls)
+  {
+    if(++calls < 3)
+    {
+      co_return std::errc::interrupted;
+    }
+    co_return 5;
+  }
+  inline awaitables::eager<result<int>> drive(awaitables::lazy<result<int>> t) { co_return co_await std::move(t); }
+}  // namespace retry_coroutines
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_retry_coroutines, "Tests that co_retry() retries transient failures, backing off with the supplied awaitable")
+{
+  using namespace retry_coroutines;
+  std::vector<retry_policy::duration> waits;
+  int calls = 0;
+  auto t = drive(co_retry(retry_policy(), [&] { return attempt(calls); }, sleep_recorder{&waits}));
+  BOOST_REQUIRE(t.await_ready());
+  BOOST_CHECK(t.await_resume().value() == 5);
+  BOOST_CHECK(calls == 3);
+  BOOST_REQUIRE(waits.size() == 2);
+  BOOST_CHECK(waits[0] <= std::chrono::milliseconds(10));
+  BOOST_CHECK(waits[1] <= std::chrono::milliseconds(20));
+}
+#endif
@@ -30,6 +30,16 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / serialisation, "Tests that the ou
   using namespace OUTCOME_V2_NAMESPACE;
   outcome<std::string> a("niall"), b(std::error_code(5, std::generic_category())), c(std::make_exception_ptr(std::ios_base::failure("A test failure message")));
   std::cout << "a contains " << print(a) << " and b contains " << print(b) << " and c contains " << print(c) << std::endl;
+  BOOST_CHECK(print(b).find(std::error_code(5, std::generic_category()).message()) != std::string::npos);
+  // Messages are cached per thread
+  BOOST_CHECK(&detail::cached_message(b.error()) == &detail::cached_message(std::error_code(5, std::generic_category())));
+  BOOST_CHECK(&detail::cached_message(b.error()) != &detail::cached_message(std::error_code(6, std::generic_category())));
+  for(int n = 0; n < 2 * OUTCOME_MESSAGE_CACHE_ENTRIES; n++)
+  {
+    // Even once the cache is full, messages are correct
+    std::error_code ec(n, std::system_category());
+    BOOST_CHECK(detail::cached_message(ec) == ec.message());
+  }
 
   std::stringstream ss;
   outcome<int, std::string, long> d(success(5));
@@ -0,0 +1,131 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/shared_result.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+#include <vector>
+
+namespace shared_result_test
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using big_type = std::vector<std::string>;
+
+  inline shared_result<big_type> fetch(bool fail)
+  {
+    if(fail)
+    {
+      return std::errc::no_such_file_or_directory;
+    }
+    return big_type{"a", "b", "c"};
+  }
+  inline result<size_t> count(bool fail)
+  {
+    OUTCOME_TRY(auto &&v, fetch(fail));
+    return v.size();
+  }
+}  // namespace shared_result_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_shared_result, "Tests that shared_result shares its value between copies, but not its error")
+{
+  using namespace shared_result_test;
+  static_assert(sizeof(shared_result<big_type>) == sizeof(result<void *>), "shared_result should be no bigger than result of a pointer");
+  static_assert(std::is_nothrow_copy_constructible<shared_result<big_type>>::value, "copying a shared_result should not throw");
+  {
+    shared_result<big_type> a = fetch(false);
+    BOOST_CHECK(a.has_value());
+    BOOST_CHECK(a.use_count() == 1);
+    {
+      // Copies share the same value rather than copying it
+      std::vector<shared_result<big_type>> subscribers(8, a);
+      BOOST_CHECK(a.use_count() == 9);
+      for(auto &i : subscribers)
+      {
+        BOOST_CHECK(&i.value() == &a.value());
+      }
+      BOOST_CHECK(subscribers.front() == a);
+      shared_result<big_type> b(std::move(subscribers.front()));
+      BOOST_CHECK(a.use_count() == 9);
+      subscribers.front() = b;
+      BOOST_CHECK(a.use_count() == 10);
+    }
+    BOOST_CHECK(a.use_count() == 1);
+    BOOST_CHECK(a.value().size() == 3);
+  }
+  {
+    shared_result<big_type> a = fetch(true);
+    BOOST_CHECK(!a);
+    BOOST_CHECK(a.has_error());
+    BOOST_CHECK(a.use_count() == 0);
+    shared_result<big_type> b(a);
+    BOOST_CHECK(b.error() == std::errc::no_such_file_or_directory);
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a != fetch(false));
+#ifdef __cpp_exceptions
+    // Observers fail as result's do
+    try
+    {
+      (void) a.value();
+      BOOST_CHECK(false);
+    }
+    catch(const std::system_error &e)
+    {
+      BOOST_CHECK(e.code() == std::errc::no_such_file_or_directory);
+    }
+    try
+    {
+      (void) fetch(false).error();
+      BOOST_CHECK(false);
+    }
+    catch(const bad_result_access &)
+    {
+    }
+#endif
+  }
+  {
+    // TRY propagates errors, and success() and failure() construct
+    BOOST_CHECK(count(false).value() == 3);
+    BOOST_CHECK(count(true).error() == std::errc::no_such_file_or_directory);
+    shared_result<std::string> a = success(std::string("hello"));
+    shared_result<std::string> b = failure(std::make_error_code(std::errc::invalid_argument));
+    BOOST_CHECK(a.value() == "hello");
+    BOOST_CHECK(b.error() == std::errc::invalid_argument);
+  }
+  {
+    // Interoperation with result is by the ValueOrError concept
+    static_assert(concepts::value_or_error<shared_result<int>>, "");
+    static_assert(!std::is_convertible<result<int>, shared_result<int>>::value, "");
+    static_assert(!std::is_convertible<shared_result<int>, result<int>>::value, "");
+    result<std::string> a("hello");
+    shared_result<std::string> b(std::move(a));
+    BOOST_CHECK(b.value() == "hello");
+    result<std::string> c(b);
+    BOOST_CHECK(c.value() == "hello");
+    result<std::string> d(std::errc::invalid_argument);
+    shared_result<std::string> e(d);
+    BOOST_CHECK(e.error() == std::errc::invalid_argument);
+    BOOST_CHECK(result<std::string>(e).error() == std::errc::invalid_argument);
+  }
+}
@@ -0,0 +1,194 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/single_flight.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_single_flight, "Tests that single_flight coalesces concurrent calls for the same key")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using flight_type = single_flight<int, result<std::string>>;
+  {
+    // Calls which do not overlap are each performed
+    flight_type sf;
+    int calls = 0;
+    BOOST_CHECK(sf.call(1, [&]() -> result<std::string> { return std::to_string(++calls); }).value() == "1");
+    BOOST_CHECK(sf.call(1, [&]() -> result<std::string> { return std::to_string(++calls); }).value() == "2");
+    BOOST_CHECK(sf.stats().calls == 2);
+    BOOST_CHECK(sf.stats().coalesced == 0);
+  }
+  {
+    // Concurrent calls for the same key are performed once, and all see its result
+    flight_type sf;
+    std::atomic<int> invocations{0};
+    std::atomic<bool> release{false};
+    auto slow = [&]() -> result<std::string> {
+      ++invocations;
+      while(!release)
+      {
+        std::this_thread::yield();
+      }
+      return std::errc::no_such_file_or_directory;
+    };
+    std::vector<std::thread> threads;
+    std::vector<result<std::string>> results(8, std::string());
+    threads.emplace_back([&] { results[0] = sf.call(1, slow); });
+    while(invocations == 0)
+    {
+      std::this_thread::yield();
+    }
+    // A different key is not held up
+    BOOST_CHECK(sf.call(2, [] { return result<std::string>("2"); }).value() == "2");
+    for(size_t n = 1; n < results.size(); n++)
+    {
+      threads.emplace_back([&, n] { results[n] = sf.call(1, slow); });
+    }
+    while(sf.stats().coalesced < results.size() - 1)
+    {
+      std::this_thread::yield();
+    }
+    release = true;
+    for(auto &i : threads)
+    {
+      i.join();
+    }
+    BOOST_CHECK(invocations == 1);
+    BOOST_CHECK(sf.stats().calls == 2);
+    for(auto &i : results)
+    {
+      BOOST_CHECK(i.error() == std::errc::no_such_file_or_directory);
+    }
+  }
+#ifdef __cpp_exceptions
+  {
+    // An exception thrown by the call is rethrown to all those waiting for it
+    flight_type sf;
+    std::atomic<bool> started{false}, release{false};
+    auto throws = [&]() -> result<std::string> {
+      started = true;
+      while(!release)
+      {
+        std::this_thread::yield();
+      }
+      throw std::runtime_error("failed");
+    };
+    std::atomic<int> caught{0};
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+      try
+      {
+        (void) sf.call(1, throws);
+      }
+      catch(const std::runtime_error &)
+      {
+        ++caught;
+      }
+    });
+    while(!started)
+    {
+      std::this_thread::yield();
+    }
+    threads.emplace_back([&] {
+      try
+      {
+        (void) sf.call(1, throws);
+      }
+      catch(const std::runtime_error &)
+      {
+        ++caught;
+      }
+    });
+    while(sf.stats().coalesced < 1)
+    {
+      std::this_thread::yield();
+    }
+    release = true;
+    for(auto &i : threads)
+    {
+      i.join();
+    }
+    BOOST_CHECK(caught == 2);
+    // The failed call is forgotten, so the next is performed afresh
+    BOOST_CHECK(sf.call(1, [] { return result<std::string>("ok"); }).value() == "ok");
+  }
+#endif
+}
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+namespace single_flight_coroutines
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using OUTCOME_V2_NAMESPACE::awaitables::atomic_eager;
+
+  // Stands in for an i/o completion which some third party signals later
+  struct io_event
+  {
+    awaitables::coroutine_handle<> waiter;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(awaitables::coroutine_handle<> h) noexcept { waiter = h; }
+    void await_resume() noexcept {}
+    void signal()
+    {
+      auto h = waiter;
+      waiter = nullptr;
+      h.resume();
+    }
+  };
+  inline atomic_eager<result<int>> fetch(io_event &ev, int &invocations, int x)
+  {
+    ++invocations;
+    co_await ev;
+    co_return x;
+  }
+}  // namespace single_flight_coroutines
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works_single_flight_coroutines, "Tests that single_flight coalesces concurrent awaitable calls for the same key")
+{
+  using namespace single_flight_coroutines;
+  single_flight<int, result<int>> sf;
+  io_event ev;
+  int invocations = 0;
+  auto a = sf.co_call(1, [&] { return fetch(ev, invocations, 5); });
+  auto b = sf.co_call(1, [&] { return fetch(ev, invocations, 6); });
+  BOOST_CHECK(!a.await_ready());
+  BOOST_CHECK(!b.await_ready());
+  BOOST_CHECK(invocations == 1);
+  BOOST_CHECK(sf.stats().coalesced == 1);
+  // Completing the leader's call resumes the follower too
+  ev.signal();
+  BOOST_REQUIRE(a.await_ready());
+  BOOST_REQUIRE(b.await_ready());
+  BOOST_CHECK(a.await_resume().value() == 5);
+  BOOST_CHECK(b.await_resume().value() == 5);
+  // A call after completion is performed afresh
+  auto c = sf.co_call(1, [&] { return fetch(ev, invocations, 7); });
+  ev.signal();
+  BOOST_REQUIRE(c.await_ready());
+  BOOST_CHECK(c.await_resume().value() == 7);
+  BOOST_CHECK(invocations == 2);
+}
+#endif